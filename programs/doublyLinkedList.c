@@ -0,0 +1,881 @@
+// ::::::::::::::::::::::::::::::::::::::::::::::::: LIBRARIES :::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+/**
+ * @file doublyLinkedList.c
+ * @author Lorenzo Mercuri
+ * @brief Methods for doubly linked list manipulation
+ * @details Each node also points to the node before it, so the operations on a node the caller already holds
+ * (insertion before or after it, removal, change) are O(1) and the list is walked in both directions.
+ * The functions on a node don't check that the node is in the list: doubly_node_in does it when needed.
+ * (doubly linked list: https://en.wikipedia.org/wiki/Doubly_linked_list).
+ * linkedList.c is included for the benchmark against the linked_list
+ */
+#define LINKEDLIST_NO_MAIN
+#include "linkedList.c"
+
+
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::: DOUBLY_LIST ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+/* LIST OF FUNCTIONS:
+    creations:
+        1) doubly_create_node
+        2) doubly_create_empty_node
+        3) doubly_create_list
+    print:
+        4) doubly_print
+        5) doubly_print_reverse
+    6) doubly_clear
+    insertions:
+        7) doubly_insertion_head_node
+        8) doubly_insertion_end_node
+        9) doubly_insertion_after_node
+        10) doubly_insertion_before_node
+    11) doubly_concatenate
+    12) doubly_split_at_node
+    13) doubly_split_at_value
+    removes:
+        14) doubly_remove_node
+        15) doubly_remove_node_with_value
+    changes:
+        16) doubly_change_node_value
+        17) doubly_change_node_value_with_value
+    18) doubly_is_empty
+    in_list:
+        19) doubly_node_in
+        20) doubly_value_in
+        21) doubly_value_in_reverse
+    22) doubly_reverse
+    23) doubly_length
+    24) doubly_max
+    25) doubly_min
+    26) doubly_count_frequents
+    27) doubly_sort (with doubly_merge_runs)
+    28) doubly_values */
+
+
+/**
+ * @struct dnode
+ * @brief Represent a node of a doubly linked list
+ * @details It has a value, a pointer to the next node and a pointer to the previous node in the list.
+ * Time complexity: O(1)
+ */
+typedef struct dnode{
+    int value1; // change type if needed (apply changes to all references)
+    struct dnode* next;
+    struct dnode* prev;
+} dnode;
+
+/**
+ * @struct doubly_list
+ * @brief Represent a doubly linked list with its head, its tail and its length
+ * @details The doubly_* functions keep the three fields up to date.
+ * Time complexity: O(1)
+ */
+typedef struct{
+    dnode* head;
+    dnode* tail;
+    unsigned int length;
+} doubly_list;
+
+
+/**
+ * @brief Create a new node of a doubly linked list
+ * @details Dynamically allocates memory for a new node,
+ * initialize the value to the argument and the pointers to NULL.
+ * Time complexity: O(1)
+ * @warning If memory allocation fails prints an error and exit program
+ * @param v1 The value of the node
+ * @return dnode* Pointer to the new node
+ */
+dnode* doubly_create_node(int v1){
+    dnode* new_node = (dnode*)malloc(sizeof(dnode)); // dynamic allocation for the new node
+    if (!new_node) {
+        printf("Memory allocation failed\n");
+        exit(EXIT_FAILURE); // critical error
+    }
+
+    (*new_node).value1 = v1;
+    (*new_node).next = (*new_node).prev = NULL;
+    return new_node;
+}
+
+/**
+ * @brief Create a new node of a doubly linked list with the default value
+ * @details Time complexity: O(1)
+ * @warning If memory allocation fails prints an error and exit program
+ * @return dnode* Pointer to the new node
+ */
+dnode* doubly_create_empty_node(){
+    return doubly_create_node(DEFAULT_VALUE);
+}
+
+
+/**
+ * @brief Create a new doubly linked list
+ * @details Dynamically allocates memory for each node of the list.
+ * Time complexity: O(n), n = number of nodes in the list
+ * @warning If memory allocation fails prints an error and exit program
+ * @param values Array of values to initialize the list
+ * @param length Number of elements in the values array
+ * @return doubly_list The new list.
+ * If the argument is NULL or the length is zero returns an empty list
+ */
+doubly_list doubly_create_list(int values[], unsigned int length){
+    doubly_list l = {NULL, NULL, 0};
+    if (length == 0 || values == NULL) return l;
+
+    l.head = l.tail = doubly_create_node(values[0]);
+    for (unsigned int i = 1; i < length; i++){
+        dnode* n = doubly_create_node(values[i]);
+        (*n).prev = l.tail;
+        (*l.tail).next = n;
+        l.tail = n;
+    }
+    l.length = length;
+    return l;
+}
+
+
+/**
+ * @brief Prints the values of each node of the doubly linked list, from the head
+ * @details Time complexity: O(n), n = number of nodes in the list
+ * @param l Pointer to the list
+ * @return void Doesn't return a value
+ */
+void doubly_print(doubly_list* l){
+    if (!l || !(*l).head) return;
+
+    printf("[");
+    for (dnode* temp = (*l).head; temp; temp = (*temp).next) printf((*temp).next ? "%d, " : "%d]", (*temp).value1);
+}
+
+/**
+ * @brief Prints the values of each node of the doubly linked list, from the tail
+ * @details Time complexity: O(n), n = number of nodes in the list
+ * @param l Pointer to the list
+ * @return void Doesn't return a value
+ */
+void doubly_print_reverse(doubly_list* l){
+    if (!l || !(*l).tail) return;
+
+    printf("[");
+    for (dnode* temp = (*l).tail; temp; temp = (*temp).prev) printf((*temp).prev ? "%d, " : "%d]", (*temp).value1);
+}
+
+
+/**
+ * @brief Frees the memory allocated for the nodes of a doubly linked list
+ * @details The list becomes empty.
+ * Time complexity: O(n), n = number of nodes in the list
+ * @param l Pointer to the list
+ * @return void Doesn't return a value
+ */
+void doubly_clear(doubly_list* l){
+    if (!l) return;
+
+    dnode* temp = (*l).head;
+    while (temp){
+        dnode* next = (*temp).next;
+        free(temp); // deallocate memory
+        temp = next;
+    }
+    (*l).head = (*l).tail = NULL;
+    (*l).length = 0;
+}
+
+
+/**
+ * @brief Insert a node at the head of a doubly linked list
+ * @details Time complexity: O(1)
+ * @param l Pointer to the list
+ * @param n Pointer to the node to be inserted at the head
+ * @return void Doesn't return a value
+ */
+void doubly_insertion_head_node(doubly_list* l, dnode* n){
+    if (!l || !n) return;
+
+    (*n).prev = NULL;
+    (*n).next = (*l).head;
+    if ((*l).head) (*(*l).head).prev = n;
+    else (*l).tail = n;
+    (*l).head = n;
+    (*l).length++;
+}
+
+
+/**
+ * @brief Insert a node at the end of a doubly linked list
+ * @details Time complexity: O(1)
+ * @param l Pointer to the list
+ * @param n Pointer to the node to be inserted at the end
+ * @return void Doesn't return a value
+ */
+void doubly_insertion_end_node(doubly_list* l, dnode* n){
+    if (!l || !n) return;
+
+    (*n).next = NULL;
+    (*n).prev = (*l).tail;
+    if ((*l).tail) (*(*l).tail).next = n;
+    else (*l).head = n;
+    (*l).tail = n;
+    (*l).length++;
+}
+
+
+/**
+ * @brief Insert a node after another node of a doubly linked list
+ * @details Time complexity: O(1)
+ * @warning n must be a node of the list (not checked, see doubly_node_in)
+ * @param l Pointer to the list
+ * @param n Pointer to the node after which the new node will be inserted
+ * @param after_n Pointer to the node to be inserted after the other node
+ * @return int 1 if the node is inserted, 0 if an argument is NULL
+ */
+int doubly_insertion_after_node(doubly_list* l, dnode* n, dnode* after_n){
+    if (!l || !n || !after_n) return 0;
+
+    (*after_n).prev = n;
+    (*after_n).next = (*n).next;
+    if ((*n).next) (*(*n).next).prev = after_n;
+    else (*l).tail = after_n;
+    (*n).next = after_n;
+    (*l).length++;
+    return 1;
+}
+
+
+/**
+ * @brief Insert a node before another node of a doubly linked list
+ * @details Time complexity: O(1)
+ * @warning n must be a node of the list (not checked, see doubly_node_in)
+ * @param l Pointer to the list
+ * @param n Pointer to the node before which the new node will be inserted
+ * @param before_n Pointer to the node to be inserted before the other node
+ * @return int 1 if the node is inserted, 0 if an argument is NULL
+ */
+int doubly_insertion_before_node(doubly_list* l, dnode* n, dnode* before_n){
+    if (!l || !n || !before_n) return 0;
+
+    (*before_n).next = n;
+    (*before_n).prev = (*n).prev;
+    if ((*n).prev) (*(*n).prev).next = before_n;
+    else (*l).head = before_n;
+    (*n).prev = before_n;
+    (*l).length++;
+    return 1;
+}
+
+
+/**
+ * @brief Concatenates two doubly linked lists
+ * @details Links the head of the second list after the tail of the first list,
+ * the second list becomes empty.
+ * Time complexity: O(1)
+ * @param l1 Pointer to the first list
+ * @param l2 Pointer to the second list
+ * @return void Doesn't return a value
+ */
+void doubly_concatenate(doubly_list* l1, doubly_list* l2){
+    if (!l1 || !l2 || l1 == l2 || !(*l2).head) return;
+
+    (*(*l2).head).prev = (*l1).tail;
+    if ((*l1).tail) (*(*l1).tail).next = (*l2).head;
+    else (*l1).head = (*l2).head;
+    (*l1).tail = (*l2).tail;
+    (*l1).length += (*l2).length;
+
+    (*l2).head = (*l2).tail = NULL;
+    (*l2).length = 0;
+}
+
+
+/**
+ * @brief Splits a doubly linked list in two lists at a specified node
+ * @details The first part (kept in l) includes all nodes up to and including the specified node,
+ * and the second part includes all nodes after it.
+ * The lengths are found walking from the node towards both ends at the same time, up to the nearest one.
+ * Time complexity: O(min(k, n - k)), k = position of the node, n = number of nodes in the list
+ * @warning n must be a node of the list (not checked, see doubly_node_in)
+ * @param l Pointer to the list
+ * @param n Pointer to the node at which the list will be split
+ * @return doubly_list The second part of the list.
+ * If nothing is after the node, the second part is empty
+ */
+doubly_list doubly_split_at_node(doubly_list* l, dnode* n){
+    doubly_list second = {NULL, NULL, 0};
+    if (!l || !n || n == (*l).tail) return second;
+
+    unsigned int steps = 0;
+    dnode* back = n;
+    dnode* forward = n;
+    while ((*back).prev && (*forward).next){
+        back = (*back).prev;
+        forward = (*forward).next;
+        steps++;
+    }
+    if (!(*forward).next) second.length = steps; // the tail is reached: steps nodes after n
+    else second.length = (*l).length - 1 - steps; // the head is reached: steps nodes before n
+
+    second.head = (*n).next;
+    second.tail = (*l).tail;
+    (*second.head).prev = NULL;
+    (*n).next = NULL;
+    (*l).tail = n;
+    (*l).length -= second.length;
+    return second;
+}
+
+/**
+ * @brief Splits a doubly linked list in two lists at a specified value
+ * @details The first part (kept in l) includes all nodes up to and including the first node with the specified value,
+ * and the second part includes all nodes after it.
+ * Time complexity: O(n), n = number of nodes before the specified value
+ * @param l Pointer to the list
+ * @param value Value of the node at which the list will be split
+ * @return doubly_list The second part of the list.
+ * If the specified value is not found, the second part is empty
+ */
+doubly_list doubly_split_at_value(doubly_list* l, int value){
+    doubly_list second = {NULL, NULL, 0};
+    if (!l) return second;
+
+    dnode* temp = (*l).head;
+    while (temp && (*temp).value1 != value) temp = (*temp).next;
+    if (!temp) return second;
+    return doubly_split_at_node(l, temp);
+}
+
+
+/**
+ * @brief Remove a node of a doubly linked list
+ * @details Links the node before it with the node after it.
+ * Time complexity: O(1)
+ * @warning n must be a node of the list (not checked, see doubly_node_in)
+ * @param l Pointer to the list
+ * @param n Pointer to the node to be removed from the list
+ * @return dnode* Pointer to the removed node.
+ * If an argument is NULL returns NULL
+ */
+dnode* doubly_remove_node(doubly_list* l, dnode* n){
+    if (!l || !n || !(*l).head) return NULL;
+
+    if ((*n).prev) (*(*n).prev).next = (*n).next;
+    else (*l).head = (*n).next;
+    if ((*n).next) (*(*n).next).prev = (*n).prev;
+    else (*l).tail = (*n).prev;
+    (*n).next = (*n).prev = NULL;
+    (*l).length--;
+    return n;
+}
+
+/**
+ * @brief Remove the first node of the doubly linked list with the value equals to the argument
+ * @details Time complexity: O(n), n = number of nodes seen in the list
+ * @param l Pointer to the list
+ * @param value The value of the node to be removed from the list
+ * @return dnode* Pointer to the removed node.
+ * If the value is not found returns NULL
+ */
+dnode* doubly_remove_node_with_value(doubly_list* l, int value){
+    if (!l) return NULL;
+
+    dnode* temp = (*l).head;
+    while (temp && (*temp).value1 != value) temp = (*temp).next;
+    return temp ? doubly_remove_node(l, temp) : NULL;
+}
+
+
+/**
+ * @brief Changes the value of a node in a doubly linked list
+ * @details Time complexity: O(1)
+ * @warning n must be a node of the list (not checked, see doubly_node_in)
+ * @param l Pointer to the list
+ * @param n Pointer to the node whose value is to be changed
+ * @param new_value The new value to be assigned to the node
+ * @return dnode* Pointer to the changed node.
+ * If an argument is NULL returns NULL
+ */
+dnode* doubly_change_node_value(doubly_list* l, dnode* n, int new_value){
+    if (!l || !n) return NULL;
+
+    (*n).value1 = new_value;
+    return n;
+}
+
+/**
+ * @brief Changes the value of the first node of a doubly linked list with a value
+ * @details Time complexity: O(n), n = number of nodes seen in the list
+ * @param l Pointer to the list
+ * @param value The value of the node to be changed
+ * @param new_value The new value to be assigned to the node
+ * @return dnode* Pointer to the changed node.
+ * If the value is not found returns NULL
+ */
+dnode* doubly_change_node_value_with_value(doubly_list* l, int value, int new_value){
+    if (!l) return NULL;
+
+    dnode* temp = (*l).head;
+    while (temp && (*temp).value1 != value) temp = (*temp).next;
+    if (temp) (*temp).value1 = new_value;
+    return temp;
+}
+
+
+/**
+ * @brief Checks if a doubly linked list is empty
+ * @details Time complexity: O(1)
+ * @param l Pointer to the list
+ * @return int Returns 1 if the list is empty, otherwise returns 0
+ */
+int doubly_is_empty(doubly_list* l){
+    return !l || (*l).length == 0;
+}
+
+
+/**
+ * @brief Checks if a node is in a doubly linked list
+ * @details Walks back from the node: it is in the list if the first node reached is the head.
+ * Time complexity: O(k), k = position of the node in its list
+ * @param l Pointer to the list
+ * @param n Pointer to the node to be searched for in the list
+ * @return dnode* Pointer to the found node.
+ * If the node is not found returns NULL
+ */
+dnode* doubly_node_in(doubly_list* l, dnode* n){
+    if (!l || !n || !(*l).head) return NULL;
+
+    dnode* temp = n;
+    while ((*temp).prev) temp = (*temp).prev;
+    return temp == (*l).head ? n : NULL;
+}
+
+/**
+ * @brief Searches for a value in a doubly linked list, from the head
+ * @details Time complexity: O(n), n = number of nodes seen in the list
+ * @param l Pointer to the list
+ * @param value Value to be searched for in the list
+ * @return dnode* Pointer to the first node with the searched value.
+ * If the value is not found returns NULL
+ */
+dnode* doubly_value_in(doubly_list* l, int value){
+    if (!l) return NULL;
+
+    dnode* temp = (*l).head;
+    while (temp && (*temp).value1 != value) temp = (*temp).next;
+    return temp;
+}
+
+/**
+ * @brief Searches for a value in a doubly linked list, from the tail
+ * @details Time complexity: O(n), n = number of nodes seen in the list
+ * @param l Pointer to the list
+ * @param value Value to be searched for in the list
+ * @return dnode* Pointer to the last node with the searched value.
+ * If the value is not found returns NULL
+ */
+dnode* doubly_value_in_reverse(doubly_list* l, int value){
+    if (!l) return NULL;
+
+    dnode* temp = (*l).tail;
+    while (temp && (*temp).value1 != value) temp = (*temp).prev;
+    return temp;
+}
+
+
+/**
+ * @brief Reverses a doubly linked list
+ * @details Swaps the two pointers of each node, the head becomes the tail.
+ * Time complexity: O(n), n = number of nodes in the list
+ * @param l Pointer to the list
+ * @return void Doesn't return a value
+ */
+void doubly_reverse(doubly_list* l){
+    if (!l) return;
+
+    for (dnode* temp = (*l).head; temp; temp = (*temp).prev){ // prev is the old next
+        dnode* next = (*temp).next;
+        (*temp).next = (*temp).prev;
+        (*temp).prev = next;
+    }
+    dnode* head = (*l).head;
+    (*l).head = (*l).tail;
+    (*l).tail = head;
+}
+
+
+/**
+ * @brief Length of a doubly linked list
+ * @details Time complexity: O(1)
+ * @param l Pointer to the list
+ * @return unsigned int The length of the list
+ */
+unsigned int doubly_length(doubly_list* l){
+    return l ? (*l).length : 0;
+}
+
+
+/**
+ * @brief Max value of a doubly linked list
+ * @details Time complexity: O(n), n = number of nodes in the list
+ * @param l Pointer to the list
+ * @return int The max value of the list.
+ * If the list is empty return the default value of a node
+ */
+int doubly_max(doubly_list* l){
+    if (!l || !(*l).head) return DEFAULT_VALUE;
+
+    int max = (*(*l).head).value1;
+    for (dnode* temp = (*l).head; temp; temp = (*temp).next)
+        if ((*temp).value1 > max) max = (*temp).value1;
+    return max;
+}
+
+/**
+ * @brief Min value of a doubly linked list
+ * @details Time complexity: O(n), n = number of nodes in the list
+ * @param l Pointer to the list
+ * @return int The min value of the list.
+ * If the list is empty return the default value of a node
+ */
+int doubly_min(doubly_list* l){
+    if (!l || !(*l).head) return DEFAULT_VALUE;
+
+    int min = (*(*l).head).value1;
+    for (dnode* temp = (*l).head; temp; temp = (*temp).next)
+        if ((*temp).value1 < min) min = (*temp).value1;
+    return min;
+}
+
+
+/**
+ * @brief Counts the frequency of a value in the doubly linked list
+ * @details Time complexity: O(n), n = number of nodes in the list
+ * @param l Pointer to the list
+ * @param value The value to count the frequency of in the list
+ * @return int The frequency of the value
+ */
+int doubly_count_frequents(doubly_list* l, int value){
+    if (!l) return 0;
+
+    int freq = 0;
+    for (dnode* temp = (*l).head; temp; temp = (*temp).next)
+        if ((*temp).value1 == value) freq++;
+    return freq;
+}
+
+
+/**
+ * @brief Merges two sorted chains of nodes linked by next
+ * @details Helper of doubly_sort, the prev pointers are not updated.
+ * Stable: for equal values the nodes of the first chain come first.
+ * Time complexity: O(n + m), n and m = number of nodes in the chains
+ * @param head1 Pointer to the head of the first sorted chain
+ * @param head2 Pointer to the head of the second sorted chain
+ * @return dnode* Pointer to the head of the merged chain
+ */
+dnode* doubly_merge_runs(dnode* head1, dnode* head2){
+    dnode merged; // placeholder before the first node
+    dnode* last = &merged;
+
+    while (head1 && head2){
+        if ((*head2).value1 < (*head1).value1){
+            (*last).next = head2;
+            head2 = (*head2).next;
+        } else {
+            (*last).next = head1;
+            head1 = (*head1).next;
+        }
+        last = (*last).next;
+    }
+    (*last).next = head1 ? head1 : head2;
+    return merged.next;
+}
+
+/**
+ * @brief Sorts a doubly linked list
+ * @details The bottom-up merge sort of sort_list on the next pointers only,
+ * then one pass sets the prev pointers and the tail.
+ * Time complexity: O(n log n), n = number of nodes in the list
+ * @param l Pointer to the list
+ * @return void Doesn't return a value
+ */
+void doubly_sort(doubly_list* l){
+    if (!l || !(*l).head || !(*(*l).head).next) return;
+
+    dnode* slots[SORT_SLOTS] = {NULL};
+    dnode* head = (*l).head;
+    while (head){
+        dnode* run = head;
+        head = (*head).next;
+        (*run).next = NULL;
+
+        int i = 0;
+        for (; i < SORT_SLOTS - 1 && slots[i]; i++){ // the runs in the slots are older: first for stability
+            run = doubly_merge_runs(slots[i], run);
+            slots[i] = NULL;
+        }
+        slots[i] = slots[i] ? doubly_merge_runs(slots[i], run) : run;
+    }
+
+    dnode* sorted = NULL;
+    for (int i = 0; i < SORT_SLOTS; i++)
+        if (slots[i]) sorted = doubly_merge_runs(slots[i], sorted);
+
+    dnode* prev = NULL;
+    for (dnode* temp = sorted; temp; temp = (*temp).next){
+        (*temp).prev = prev;
+        prev = temp;
+    }
+    (*l).head = sorted;
+    (*l).tail = prev;
+}
+
+
+/**
+ * @brief Extracts the values from a doubly linked list into an array
+ * @details Time complexity: O(n), n = number of nodes in the list
+ * @param l Pointer to the list
+ * @return int* Pointer to an array containing the values of the list nodes, from the head.
+ * If the list is empty, returns NULL.
+ * If memory allocation fails, the program exits with an error
+ */
+int* doubly_values(doubly_list* l){
+    if (!l || !(*l).head) return NULL;
+
+    int* values = (int*)malloc((*l).length * sizeof(int)); // dynamic allocation for the values
+    if (!values) {
+        printf("Memory allocation failed\n");
+        exit(EXIT_FAILURE); // critical error
+    }
+
+    dnode* temp = (*l).head;
+    for (unsigned int i = 0; temp; i++){
+        values[i] = (*temp).value1;
+        temp = (*temp).next;
+    }
+    return values;
+}
+
+
+
+
+// :::::::::::::::::::::::::::::::::::::::::::::::::: BENCHMARKS :::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+/**
+ * @brief Compares the operations on a held node of the doubly linked list with the linked_list ones
+ * @details Values 0, ..., n-1, with an array of the nodes of each list.
+ * Prints ns/operation of removing a random node and inserting it back before its old successor,
+ * of inserting a node after a random node and removing it, and of changing a random node,
+ * with the doubly linked list (ops operations) and with the linked_list (ops / 1000, they walk the list).
+ * Time complexity: O(ops * (1 + n / 1000))
+ * @warning If memory allocation fails prints an error and exit program
+ * @param n Number of nodes of the lists
+ * @param ops Number of operations of each kind on the doubly linked list
+ * @return void Doesn't return a value
+ */
+void benchmark_doubly(unsigned int n, unsigned int ops){
+    if (n < 2) return;
+    int* values = benchmark_values(n);
+    doubly_list doubly = doubly_create_list(values, n);
+    linked_list plain = linked_list_create(values, n);
+    dnode** dnodes = (dnode**)malloc(n * sizeof(dnode*));
+    node** nodes = (node**)malloc(n * sizeof(node*));
+    if (!dnodes || !nodes) {
+        printf("Memory allocation failed\n");
+        exit(EXIT_FAILURE); // critical error
+    }
+    dnode* d = doubly.head;
+    node* p = plain.head;
+    for (unsigned int i = 0; i < n; i++, d = (*d).next, p = (*p).next){
+        dnodes[i] = d;
+        nodes[i] = p;
+    }
+    dnode* dextra = doubly_create_node(-1);
+    node* extra = create_node(-1);
+    long long sink = 0;
+
+    const char* names[] = {"remove and insert before", "insert after and remove", "change"};
+    for (int kind = 0; kind < 3; kind++){
+        double times[2];
+        for (int k = 0; k < 2; k++){
+            unsigned int m = k ? ops / 1000 + 1 : ops;
+            clock_t start = clock();
+            for (unsigned int i = 0; i < m; i++){
+                unsigned int at = (unsigned int)(((unsigned long long)i * 2654435761u) % (n - 1)); // never the tail
+                if (kind == 0){
+                    if (k){
+                        node* next = (*nodes[at]).next;
+                        linked_list_remove_node(&plain, nodes[at]);
+                        linked_list_insertion_before_node(&plain, next, nodes[at]);
+                    } else {
+                        dnode* next = (*dnodes[at]).next;
+                        doubly_remove_node(&doubly, dnodes[at]);
+                        doubly_insertion_before_node(&doubly, next, dnodes[at]);
+                    }
+                } else if (kind == 1){
+                    if (k){
+                        linked_list_insertion_after_node(&plain, nodes[at], extra);
+                        linked_list_remove_node(&plain, extra);
+                    } else {
+                        doubly_insertion_after_node(&doubly, dnodes[at], dextra);
+                        doubly_remove_node(&doubly, dextra);
+                    }
+                } else {
+                    if (k) sink += linked_list_change_node_value(&plain, nodes[at], (int)at) != NULL;
+                    else sink += doubly_change_node_value(&doubly, dnodes[at], (int)at) != NULL;
+                }
+            }
+            times[k] = ns_per_element(start, m);
+        }
+        printf("%s: doubly %.2f ns/op, linked_list %.2f ns/op\n", names[kind], times[0], times[1]);
+    }
+
+    printf("node: doubly %zu bytes, linked_list %zu bytes (checksum %lld)\n", sizeof(dnode), sizeof(node), sink);
+    free(dextra);
+    free(extra);
+    free(dnodes);
+    free(nodes);
+    doubly_clear(&doubly);
+    linked_list_clear(&plain);
+    free(values);
+}
+
+
+
+
+// :::::::::::::::::::::::::::::::::::::::::::::::::::::: TESTS ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+/**
+ * @brief Checks a doubly linked list against the expected values, used by the tests
+ * @details Walks the list from the head and from the tail: the values must be the expected ones in order,
+ * each next must be matched by the prev of the node after it, the head has no prev and the tail has no next,
+ * and the length must be the number of nodes (NULL head and tail if empty).
+ * Time complexity: O(n), n = number of nodes in the list
+ * @param l Pointer to the list
+ * @param values Array of the expected values
+ * @param length Number of expected values
+ * @return int 1 if the list has the values, 0 otherwise
+ */
+int test_doubly_matches(doubly_list* l, int values[], unsigned int length){
+    if ((*l).length != length || !(*l).head != !(*l).tail) return 0;
+    unsigned int i = 0;
+    dnode* prev = NULL;
+    for (dnode* temp = (*l).head; temp; prev = temp, temp = (*temp).next, i++)
+        if (i >= length || (*temp).value1 != values[i] || (*temp).prev != prev) return 0;
+    if (i != length || (*l).tail != prev) return 0;
+
+    dnode* next = NULL;
+    for (dnode* temp = (*l).tail; temp; next = temp, temp = (*temp).prev)
+        if (i == 0 || (*temp).value1 != values[--i] || (*temp).next != next) return 0;
+    return i == 0 && (*l).head == next;
+}
+
+/**
+ * @brief Tests the insertions and the removes of a doubly linked list
+ * @details Inserts at the head, at the end, after and before the head, a middle node and the tail,
+ * then removes the head, the tail, a middle node, a value not in the list and every node left,
+ * checking the values and the links in both directions after each operation.
+ * Time complexity: O(1)
+ * @return int 1 if the test passes, 0 otherwise
+ */
+int test_doubly_insert_remove(){
+    int start[2] = {2, 4};
+    doubly_list l = doubly_create_list(start, 2);
+    int passed = test_doubly_matches(&l, start, 2);
+
+    doubly_insertion_head_node(&l, doubly_create_node(1));
+    int step1[3] = {1, 2, 4};
+    passed = passed && test_doubly_matches(&l, step1, 3);
+    doubly_insertion_end_node(&l, doubly_create_node(6));
+    int step2[4] = {1, 2, 4, 6};
+    passed = passed && test_doubly_matches(&l, step2, 4);
+    passed = passed && doubly_insertion_before_node(&l, l.head, doubly_create_node(0));
+    int step3[5] = {0, 1, 2, 4, 6};
+    passed = passed && test_doubly_matches(&l, step3, 5);
+    passed = passed && doubly_insertion_after_node(&l, l.tail, doubly_create_node(7));
+    int step4[6] = {0, 1, 2, 4, 6, 7};
+    passed = passed && test_doubly_matches(&l, step4, 6);
+    dnode* middle = doubly_value_in(&l, 4);
+    passed = passed && doubly_insertion_before_node(&l, middle, doubly_create_node(3));
+    passed = passed && doubly_insertion_after_node(&l, middle, doubly_create_node(5));
+    int step5[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+    passed = passed && test_doubly_matches(&l, step5, 8);
+    passed = passed && doubly_insertion_after_node(&l, l.head, doubly_create_node(9));
+    int step6[9] = {0, 9, 1, 2, 3, 4, 5, 6, 7};
+    passed = passed && test_doubly_matches(&l, step6, 9);
+    passed = passed && !doubly_insertion_after_node(&l, NULL, middle);
+
+    free(doubly_remove_node(&l, l.head));
+    int step7[8] = {9, 1, 2, 3, 4, 5, 6, 7};
+    passed = passed && test_doubly_matches(&l, step7, 8);
+    free(doubly_remove_node(&l, l.tail));
+    int step8[7] = {9, 1, 2, 3, 4, 5, 6};
+    passed = passed && test_doubly_matches(&l, step8, 7);
+    passed = passed && doubly_remove_node(&l, middle) == middle && !(*middle).next && !(*middle).prev;
+    free(middle);
+    int step9[6] = {9, 1, 2, 3, 5, 6};
+    passed = passed && test_doubly_matches(&l, step9, 6);
+    passed = passed && !doubly_remove_node_with_value(&l, 42) && test_doubly_matches(&l, step9, 6);
+    free(doubly_remove_node_with_value(&l, 9));
+    int step10[5] = {1, 2, 3, 5, 6};
+    passed = passed && test_doubly_matches(&l, step10, 5);
+
+    while (l.head) free(doubly_remove_node(&l, l.tail));
+    passed = passed && test_doubly_matches(&l, NULL, 0) && !doubly_remove_node(&l, l.head);
+    doubly_insertion_end_node(&l, doubly_create_node(8)); // into the empty list
+    int single[1] = {8};
+    passed = passed && test_doubly_matches(&l, single, 1);
+    printf("insertions and removes: %s\n", passed ? "passed" : "FAILED");
+    doubly_clear(&l);
+    return passed;
+}
+
+/**
+ * @brief Tests the splits of a doubly linked list
+ * @details Splits a list of 10 values after the node at each index, from the head (index 0: only the head is kept)
+ * to the tail (index 9: the second part is empty): the nodes near the head make doubly_split_at_node
+ * reach the head first, those near the tail reach the tail first. Checks both parts in both directions,
+ * then concatenates them back. Also splits at a value and at a value not in the list.
+ * Time complexity: O(1)
+ * @return int 1 if the test passes, 0 otherwise
+ */
+int test_doubly_split(){
+    int values[10] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    doubly_list l = doubly_create_list(values, 10);
+    int passed = 1;
+    for (unsigned int index = 0; index < 10; index++){
+        dnode* n = l.head;
+        for (unsigned int i = 0; i < index; i++) n = (*n).next;
+        doubly_list second = doubly_split_at_node(&l, n);
+        passed = passed && test_doubly_matches(&l, values, index + 1);
+        passed = passed && test_doubly_matches(&second, values + index + 1, 9 - index);
+        doubly_concatenate(&l, &second);
+        passed = passed && test_doubly_matches(&l, values, 10) && test_doubly_matches(&second, NULL, 0);
+    }
+
+    doubly_list second = doubly_split_at_value(&l, 6);
+    passed = passed && test_doubly_matches(&l, values, 7) && test_doubly_matches(&second, values + 7, 3);
+    doubly_list none = doubly_split_at_value(&l, 42);
+    passed = passed && test_doubly_matches(&l, values, 7) && test_doubly_matches(&none, NULL, 0);
+    printf("splits: %s\n", passed ? "passed" : "FAILED");
+    doubly_clear(&l);
+    doubly_clear(&second);
+    return passed;
+}
+
+
+/**
+ * @brief Entry point of the program, used for testing
+ * @details Runs the tests, then the doubly linked list benchmark
+ * (the optional arguments are the number of nodes, default 100000, and of operations, default 1000000).
+ * @return 0 if the tests pass, 1 otherwise
+ */
+int main(int argc, char* argv[]){
+    int passed = test_doubly_insert_remove();
+    passed = test_doubly_split() && passed;
+
+    unsigned int n = argc > 1 ? (unsigned int)strtoul(argv[1], NULL, 10) : 100000;
+    unsigned int ops = argc > 2 ? (unsigned int)strtoul(argv[2], NULL, 10) : 1000000;
+    benchmark_doubly(n, ops);
+    return passed ? 0 : 1;
+
+    /* compiling: gcc doublyLinkedList.c -o doublyLinkedList -lpthread
+    executing: doublyLinkedList [nodes [operations]] */
+}
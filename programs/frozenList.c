@@ -0,0 +1,637 @@
+// ::::::::::::::::::::::::::::::::::::::::::::::::: LIBRARIES :::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+/**
+ * @file frozenList.c
+ * @author Lorenzo Mercuri
+ * @brief Methods for read only lists stored compressed
+ * @details A frozen list keeps the values of a list in one array of bytes: each value is stored as the difference
+ * from the value before it, written as a varint (7 bits for each byte, the high bit set if more bytes follow),
+ * so the small differences of sorted lists take 1 or 2 bytes instead of the 16 bytes of a node.
+ * The differences of lists that are not sorted are zigzag encoded first (0, -1, 1, -2, ... become 0, 1, 2, 3, ...);
+ * a block whose differences take more bytes than its values (e.g. random values) stores the values instead.
+ * The values are grouped in blocks of FROZEN_BLOCK_VALUES: an index keeps the first value, min, max and offset
+ * of each block, so min and max are read from the index, searches skip the blocks that can't have the value
+ * (and use binary search on sorted lists) and only the needed blocks are decoded, in a small buffer.
+ * (varint: https://protobuf.dev/programming-guides/encoding/#varints).
+ * linkedList.c is included for the lists to freeze and the aggregates
+ */
+#define LINKEDLIST_NO_MAIN
+#include "linkedList.c"
+#include <stdint.h>
+
+
+
+// :::::::::::::::::::::::::::::::::::::::::::::::::: FROZEN_LIST ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+/* LIST OF FUNCTIONS:
+    1) frozen_create (with frozen_encode_block and frozen_write_varint)
+    2) frozen_clear
+    3) frozen_bytes
+    iteration:
+        4) frozen_begin
+        5) frozen_next
+    6) frozen_print
+    7) frozen_length
+    in_list:
+        8) frozen_value_in
+        9) frozen_value_at
+    10) frozen_count_frequents
+    11) frozen_max
+    12) frozen_min
+    13) frozen_aggregate
+    14) frozen_to_linked_list
+    helpers: frozen_read_varint, frozen_decode_block, frozen_first_block */
+
+
+#define FROZEN_BLOCK_VALUES 128 // values decoded together, one entry of the index for each block
+#define FROZEN_MAX_VARINT 5 // bytes of the largest difference (33 bits)
+
+/**
+ * @struct frozen_block
+ * @brief Represent an entry of the index of a frozen list
+ * @details It has the first value of the block (not in the bytes), the min and max of the block,
+ * whether the other values are stored as ints instead of varints and their offset in the bytes.
+ * Time complexity: O(1)
+ */
+typedef struct{
+    int first;
+    int min;
+    int max;
+    int raw;
+    size_t offset;
+} frozen_block;
+
+/**
+ * @struct frozen_list
+ * @brief Represent a read only compressed list
+ * @details It has the encoded differences, their size in bytes, the index of the blocks,
+ * the number of values and whether the values are sorted (non decreasing).
+ * Time complexity: O(1)
+ */
+typedef struct{
+    unsigned char* bytes;
+    size_t size;
+    frozen_block* blocks;
+    unsigned int block_count;
+    unsigned int length;
+    int sorted;
+} frozen_list;
+
+/**
+ * @struct frozen_iterator
+ * @brief Represent a position in a frozen list, for reading the values in order
+ * @details It has the list, the index of the next value, the offset of its difference and the last value read.
+ * Time complexity: O(1)
+ */
+typedef struct{
+    const frozen_list* f;
+    unsigned int index;
+    size_t offset;
+    int value;
+} frozen_iterator;
+
+
+/**
+ * @brief Writes a varint at the end of the bytes of a frozen list
+ * @details Doubles the bytes when they are full.
+ * Time complexity: O(1) amortized
+ * @warning If memory allocation fails prints an error and exit program
+ * @param f Pointer to the frozen list being created
+ * @param capacity Pointer to the allocated size of the bytes
+ * @param x The number to write
+ * @return void Doesn't return a value
+ */
+void frozen_write_varint(frozen_list* f, size_t* capacity, uint64_t x){
+    if ((*f).size + FROZEN_MAX_VARINT > *capacity){
+        *capacity = 2 * *capacity + FROZEN_MAX_VARINT;
+        unsigned char* bytes = (unsigned char*)realloc((*f).bytes, *capacity);
+        if (!bytes) {
+            printf("Memory allocation failed\n");
+            exit(EXIT_FAILURE); // critical error
+        }
+        (*f).bytes = bytes;
+    }
+    while (x >= 0x80){
+        (*f).bytes[(*f).size++] = (unsigned char)(x | 0x80);
+        x >>= 7;
+    }
+    (*f).bytes[(*f).size++] = (unsigned char)x;
+}
+
+/**
+ * @brief Reads a varint from the bytes of a frozen list
+ * @details Time complexity: O(1)
+ * @param bytes Pointer to the bytes
+ * @param offset Pointer to the offset of the varint, moved after it
+ * @return uint64_t The number read
+ */
+uint64_t frozen_read_varint(const unsigned char* bytes, size_t* offset){
+    uint64_t x = 0;
+    unsigned int shift = 0;
+    unsigned char b;
+    do {
+        b = bytes[(*offset)++];
+        x |= (uint64_t)(b & 0x7f) << shift;
+        shift += 7;
+    } while (b & 0x80);
+    return x;
+}
+
+
+/**
+ * @brief Appends a block of values to a frozen list
+ * @details Writes the differences as varints; if they take more bytes than the values (large differences,
+ * as between random values) they are replaced by the values as ints.
+ * Time complexity: O(FROZEN_BLOCK_VALUES)
+ * @warning If memory allocation fails prints an error and exit program
+ * @param f Pointer to the frozen list being created
+ * @param capacity Pointer to the allocated size of the bytes
+ * @param values Array of the values of the block
+ * @param count Number of values of the block (1 to FROZEN_BLOCK_VALUES)
+ * @return void Doesn't return a value
+ */
+void frozen_encode_block(frozen_list* f, size_t* capacity, const int values[], unsigned int count){
+    frozen_block* block = &(*f).blocks[(*f).block_count++];
+    (*block).first = (*block).min = (*block).max = values[0];
+    (*block).raw = 0;
+    (*block).offset = (*f).size;
+    for (unsigned int i = 1; i < count; i++){
+        int64_t delta = (int64_t)values[i] - values[i - 1];
+        frozen_write_varint(f, capacity, (*f).sorted ? (uint64_t)delta : ((uint64_t)delta << 1) ^ (uint64_t)(delta >> 63));
+        if (values[i] < (*block).min) (*block).min = values[i];
+        if (values[i] > (*block).max) (*block).max = values[i];
+    }
+
+    size_t raw_size = (count - 1) * sizeof(int);
+    if ((*f).size - (*block).offset > raw_size){ // the varints were longer, so the bytes have room for the ints
+        memcpy((*f).bytes + (*block).offset, values + 1, raw_size);
+        (*f).size = (*block).offset + raw_size;
+        (*block).raw = 1;
+    }
+}
+
+
+/**
+ * @brief Creates a frozen list with the values of a linked list
+ * @details One walk to find the length and whether the list is sorted, one walk to encode the values
+ * block by block; the bytes are then shrunk to their size. The linked list is not changed.
+ * Time complexity: O(n), n = number of nodes in the list
+ * @warning If memory allocation fails prints an error and exit program
+ * @param head Pointer to the head of the linked list
+ * @return frozen_list The frozen list (with no bytes if the linked list is empty)
+ */
+frozen_list frozen_create(node* head){
+    frozen_list f = {NULL, 0, NULL, 0, 0, 1};
+    if (!head) return f;
+
+    for (node* temp = head; temp; temp = (*temp).next){
+        if ((*temp).next && (*(*temp).next).value1 < (*temp).value1) f.sorted = 0;
+        f.length++;
+    }
+    f.blocks = (frozen_block*)malloc((f.length + FROZEN_BLOCK_VALUES - 1) / FROZEN_BLOCK_VALUES * sizeof(frozen_block));
+    size_t capacity = f.length;
+    f.bytes = (unsigned char*)malloc(capacity);
+    if (!f.blocks || !f.bytes) {
+        printf("Memory allocation failed\n");
+        exit(EXIT_FAILURE); // critical error
+    }
+
+    int values[FROZEN_BLOCK_VALUES];
+    unsigned int count = 0;
+    for (node* temp = head; temp; temp = (*temp).next){
+        values[count++] = (*temp).value1;
+        if (count == FROZEN_BLOCK_VALUES || !(*temp).next){
+            frozen_encode_block(&f, &capacity, values, count);
+            count = 0;
+        }
+    }
+
+    if (f.size){ // a list of one value per block has no differences
+        unsigned char* bytes = (unsigned char*)realloc(f.bytes, f.size);
+        if (bytes) f.bytes = bytes;
+    }
+    return f;
+}
+
+
+/**
+ * @brief Frees the memory allocated for a frozen list
+ * @details Time complexity: O(1)
+ * @param f Pointer to the frozen list
+ * @return void Doesn't return a value
+ */
+void frozen_clear(frozen_list* f){
+    if (!f) return;
+
+    free((*f).bytes); // deallocate memory
+    free((*f).blocks);
+    (*f).bytes = NULL;
+    (*f).blocks = NULL;
+    (*f).size = 0;
+    (*f).block_count = (*f).length = 0;
+    (*f).sorted = 1;
+}
+
+
+/**
+ * @brief Memory used by a frozen list
+ * @details Time complexity: O(1)
+ * @param f Pointer to the frozen list
+ * @return size_t Bytes of the differences, of the index and of the frozen_list itself
+ */
+size_t frozen_bytes(const frozen_list* f){
+    return f ? sizeof(frozen_list) + (*f).size + (*f).block_count * sizeof(frozen_block) : 0;
+}
+
+
+/**
+ * @brief Decodes the values of a block of a frozen list
+ * @details Time complexity: O(FROZEN_BLOCK_VALUES)
+ * @param f Pointer to the frozen list
+ * @param b Index of the block
+ * @param values Array of at least FROZEN_BLOCK_VALUES values, written with the values of the block
+ * @return unsigned int Number of values of the block
+ */
+unsigned int frozen_decode_block(const frozen_list* f, unsigned int b, int values[]){
+    unsigned int count = (*f).length - b * FROZEN_BLOCK_VALUES;
+    if (count > FROZEN_BLOCK_VALUES) count = FROZEN_BLOCK_VALUES;
+
+    const unsigned char* bytes = (*f).bytes;
+    size_t offset = (*f).blocks[b].offset;
+    int64_t v = (*f).blocks[b].first;
+    values[0] = (int)v;
+    if ((*f).blocks[b].raw) memcpy(values + 1, bytes + offset, (count - 1) * sizeof(int));
+    else if ((*f).sorted){
+        for (unsigned int i = 1; i < count; i++){
+            uint64_t x = bytes[offset] < 0x80 ? bytes[offset++] : frozen_read_varint(bytes, &offset); // 1 byte is the common case
+            v += (int64_t)x;
+            values[i] = (int)v;
+        }
+    } else {
+        for (unsigned int i = 1; i < count; i++){
+            uint64_t x = bytes[offset] < 0x80 ? bytes[offset++] : frozen_read_varint(bytes, &offset);
+            v += (int64_t)(x >> 1) ^ -(int64_t)(x & 1);
+            values[i] = (int)v;
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief First block of a frozen list that can have a value
+ * @details On a sorted list binary search of the first block with max >= value (the earlier blocks only have
+ * smaller values), otherwise 0.
+ * Time complexity: O(log b), b = number of blocks
+ * @param f Pointer to the frozen list
+ * @param value The searched value
+ * @return unsigned int Index of the block (block_count if no block can have the value)
+ */
+unsigned int frozen_first_block(const frozen_list* f, int value){
+    if (!(*f).sorted) return 0;
+
+    unsigned int low = 0, high = (*f).block_count;
+    while (low < high){
+        unsigned int middle = low + (high - low) / 2;
+        if ((*f).blocks[middle].max < value) low = middle + 1;
+        else high = middle;
+    }
+    return low;
+}
+
+
+/**
+ * @brief Starts an iteration over the values of a frozen list
+ * @details Time complexity: O(1)
+ * @param f Pointer to the frozen list
+ * @return frozen_iterator The iterator before the first value
+ */
+frozen_iterator frozen_begin(const frozen_list* f){
+    frozen_iterator it = {f, 0, 0, 0};
+    return it;
+}
+
+/**
+ * @brief Reads the next value of a frozen list
+ * @details The first value of a block comes from the index, the others add their difference to the value before
+ * (or are read as ints).
+ * Time complexity: O(1)
+ * @param it Pointer to the iterator
+ * @param value Pointer where the value is written
+ * @return int 1 if a value is read, 0 after the last value
+ */
+int frozen_next(frozen_iterator* it, int* value){
+    const frozen_list* f = (*it).f;
+    if (!f || (*it).index >= (*f).length) return 0;
+
+    if ((*it).index % FROZEN_BLOCK_VALUES == 0){
+        const frozen_block* block = &(*f).blocks[(*it).index / FROZEN_BLOCK_VALUES];
+        (*it).value = (*block).first;
+        (*it).offset = (*block).offset;
+    } else if ((*f).blocks[(*it).index / FROZEN_BLOCK_VALUES].raw){
+        memcpy(&(*it).value, (*f).bytes + (*it).offset, sizeof(int));
+        (*it).offset += sizeof(int);
+    } else {
+        uint64_t x = frozen_read_varint((*f).bytes, &(*it).offset);
+        (*it).value = (int)((int64_t)(*it).value + ((*f).sorted ? (int64_t)x : (int64_t)(x >> 1) ^ -(int64_t)(x & 1)));
+    }
+    (*it).index++;
+    if (value) *value = (*it).value;
+    return 1;
+}
+
+
+/**
+ * @brief Prints the values of a frozen list
+ * @details Time complexity: O(n), n = number of values in the list
+ * @param f Pointer to the frozen list
+ * @return void Doesn't return a value
+ */
+void frozen_print(const frozen_list* f){
+    if (!f || (*f).length == 0) return;
+
+    frozen_iterator it = frozen_begin(f);
+    int v;
+    printf("[");
+    while (frozen_next(&it, &v)) printf(it.index < (*f).length ? "%d, " : "%d]", v);
+}
+
+
+/**
+ * @brief Length of a frozen list
+ * @details Time complexity: O(1)
+ * @param f Pointer to the frozen list
+ * @return unsigned int The number of values in the list
+ */
+unsigned int frozen_length(const frozen_list* f){
+    return f ? (*f).length : 0;
+}
+
+
+/**
+ * @brief Searches for a value in a frozen list
+ * @details Decodes only the blocks whose min and max include the value, starting from frozen_first_block;
+ * on a sorted list stops at the first block starting after the value.
+ * Time complexity: O(log b + FROZEN_BLOCK_VALUES) if sorted, otherwise O(n) in the worst case,
+ * b = number of blocks, n = number of values in the list
+ * @param f Pointer to the frozen list
+ * @param value Value to be searched for in the list
+ * @return long long Position of the first value equal to the searched value, -1 if the value is not found
+ */
+long long frozen_value_in(const frozen_list* f, int value){
+    if (!f) return -1;
+
+    int values[FROZEN_BLOCK_VALUES];
+    for (unsigned int b = frozen_first_block(f, value); b < (*f).block_count; b++){
+        if ((*f).sorted && (*f).blocks[b].first > value) break;
+        if (value < (*f).blocks[b].min || value > (*f).blocks[b].max) continue;
+        unsigned int count = frozen_decode_block(f, b, values);
+        for (unsigned int i = 0; i < count; i++)
+            if (values[i] == value) return (long long)b * FROZEN_BLOCK_VALUES + i;
+    }
+    return -1;
+}
+
+
+/**
+ * @brief Value at a position of a frozen list
+ * @details Reads the differences of its block up to the position.
+ * Time complexity: O(FROZEN_BLOCK_VALUES)
+ * @param f Pointer to the frozen list
+ * @param index Position of the value (0 for the first value)
+ * @return int The value at the position.
+ * If the position is not in the list return the default value of a node
+ */
+int frozen_value_at(const frozen_list* f, unsigned int index){
+    if (!f || index >= (*f).length) return DEFAULT_VALUE;
+
+    frozen_iterator it = {f, index - index % FROZEN_BLOCK_VALUES, 0, 0};
+    int v = DEFAULT_VALUE;
+    while (it.index <= index) frozen_next(&it, &v);
+    return v;
+}
+
+
+/**
+ * @brief Counts the frequency of a value in a frozen list
+ * @details Decodes only the blocks whose min and max include the value (as frozen_value_in).
+ * Time complexity: O(log b + k) if sorted, k = number of values decoded, otherwise O(n) in the worst case,
+ * b = number of blocks, n = number of values in the list
+ * @param f Pointer to the frozen list
+ * @param value The value to count the frequency of in the list
+ * @return unsigned int The frequency of the value
+ */
+unsigned int frozen_count_frequents(const frozen_list* f, int value){
+    if (!f) return 0;
+
+    unsigned int freq = 0;
+    int values[FROZEN_BLOCK_VALUES];
+    for (unsigned int b = frozen_first_block(f, value); b < (*f).block_count; b++){
+        if ((*f).sorted && (*f).blocks[b].first > value) break;
+        if (value < (*f).blocks[b].min || value > (*f).blocks[b].max) continue;
+        if ((*f).blocks[b].min == value && (*f).blocks[b].max == value){ // every value of the block
+            freq += b + 1 < (*f).block_count ? FROZEN_BLOCK_VALUES : (*f).length - b * FROZEN_BLOCK_VALUES;
+            continue;
+        }
+        unsigned int count = frozen_decode_block(f, b, values);
+        for (unsigned int i = 0; i < count; i++) freq += values[i] == value;
+    }
+    return freq;
+}
+
+
+/**
+ * @brief Max value of a frozen list
+ * @details Read from the index (the last value on a sorted list).
+ * Time complexity: O(b), b = number of blocks (O(1) if sorted)
+ * @param f Pointer to the frozen list
+ * @return int The max value of the list.
+ * If the list is empty return the default value of a node
+ */
+int frozen_max(const frozen_list* f){
+    if (!f || (*f).block_count == 0) return DEFAULT_VALUE;
+    if ((*f).sorted) return (*f).blocks[(*f).block_count - 1].max;
+
+    int max = (*f).blocks[0].max;
+    for (unsigned int b = 1; b < (*f).block_count; b++)
+        if ((*f).blocks[b].max > max) max = (*f).blocks[b].max;
+    return max;
+}
+
+/**
+ * @brief Min value of a frozen list
+ * @details Read from the index (the first value on a sorted list).
+ * Time complexity: O(b), b = number of blocks (O(1) if sorted)
+ * @param f Pointer to the frozen list
+ * @return int The min value of the list.
+ * If the list is empty return the default value of a node
+ */
+int frozen_min(const frozen_list* f){
+    if (!f || (*f).block_count == 0) return DEFAULT_VALUE;
+    if ((*f).sorted) return (*f).blocks[0].min;
+
+    int min = (*f).blocks[0].min;
+    for (unsigned int b = 1; b < (*f).block_count; b++)
+        if ((*f).blocks[b].min < min) min = (*f).blocks[b].min;
+    return min;
+}
+
+
+/**
+ * @brief Computes the selected aggregates of a frozen list
+ * @details As aggregate_list: min, max and length come from the index,
+ * the frequency from frozen_count_frequents (only if requested).
+ * Time complexity: O(b + k), b = number of blocks, k = number of values decoded for the frequency
+ * @param f Pointer to the frozen list
+ * @param which Bitwise OR of AGGREGATE_MIN, AGGREGATE_MAX, AGGREGATE_LENGTH and AGGREGATE_FREQUENCY
+ * @param value The value counted by AGGREGATE_FREQUENCY
+ * @return aggregates The selected aggregates (min and max are the default value if the list is empty)
+ */
+aggregates frozen_aggregate(const frozen_list* f, unsigned int which, int value){
+    aggregates result = {DEFAULT_VALUE, DEFAULT_VALUE, 0, 0};
+    if (!f || (*f).length == 0) return result;
+
+    if (which & AGGREGATE_MIN) result.min = frozen_min(f);
+    if (which & AGGREGATE_MAX) result.max = frozen_max(f);
+    if (which & AGGREGATE_LENGTH) result.length = (int)(*f).length;
+    if (which & AGGREGATE_FREQUENCY) result.frequency = (int)frozen_count_frequents(f, value);
+    return result;
+}
+
+
+/**
+ * @brief Creates a linked list with the values of a frozen list
+ * @details With an arena the nodes are consecutive nodes of one slab, otherwise one malloc for each node.
+ * The values are decoded block by block into the nodes.
+ * Time complexity: O(n), n = number of values in the list
+ * @warning If memory allocation fails prints an error and exit program
+ * @param f Pointer to the frozen list
+ * @param a Pointer to the arena for the nodes, NULL to allocate them with malloc
+ * @return linked_list The new linked list
+ */
+linked_list frozen_to_linked_list(const frozen_list* f, arena* a){
+    linked_list l = {NULL, NULL, 0};
+    if (!f || (*f).length == 0) return l;
+
+    int values[FROZEN_BLOCK_VALUES];
+    node* nodes = a ? arena_reserve_nodes(a, (*f).length) : NULL;
+    node* last = NULL;
+    for (unsigned int b = 0; b < (*f).block_count; b++){
+        unsigned int count = frozen_decode_block(f, b, values);
+        for (unsigned int i = 0; i < count; i++){
+            node* n = a ? nodes + l.length : create_node(values[i]);
+            (*n).value1 = values[i];
+            (*n).next = NULL;
+            if (l.length == 0) l.head = n;
+            else (*last).next = n;
+            last = n;
+            l.length++;
+        }
+    }
+    l.tail = last;
+    return l;
+}
+
+
+
+
+// :::::::::::::::::::::::::::::::::::::::::::::::::: BENCHMARKS :::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+#define FROZEN_SEARCHES 100 // searches of the benchmark, each one walks the linked list
+
+/**
+ * @brief Compares a frozen list with a linked list
+ * @details For n sorted values (random gaps from 0 to 15) and n random values prints the bytes for each value
+ * of the frozen list and of the linked list (sizeof(node)), the ns/value of frozen_create, of a walk (sum),
+ * of frozen_to_linked_list and of FROZEN_SEARCHES searches (frozen_value_in and value_in_list),
+ * and checks the values and the aggregates against the linked list.
+ * Time complexity: O(n * FROZEN_SEARCHES)
+ * @param n Number of values of the lists
+ * @return int 1 if the results are the same, 0 otherwise
+ */
+int benchmark_frozen(unsigned int n){
+    if (n == 0) return 1;
+    int* values = benchmark_values(n);
+    int ok = 1;
+    srand(12345);
+
+    for (int sorted = 1; sorted >= 0; sorted--){
+        for (unsigned int i = 0; i < n; i++) values[i] = sorted ? (i ? values[i - 1] : -1000) + rand() % 16 : rand() - RAND_MAX / 2;
+        arena* a = create_arena(0);
+        linked_list l = {arena_create_list(a, values, n), NULL, n};
+        l.tail = l.head + (n - 1);
+
+        double start = wall_seconds();
+        frozen_list f = frozen_create(l.head);
+        double create = wall_seconds() - start;
+
+        long long list_sum = 0, frozen_sum = 0;
+        start = wall_seconds();
+        for (node* temp = l.head; temp; temp = (*temp).next) list_sum += (*temp).value1;
+        double list_walk = wall_seconds() - start;
+        start = wall_seconds();
+        frozen_iterator it = frozen_begin(&f);
+        int v;
+        while (frozen_next(&it, &v)) frozen_sum += v;
+        double frozen_walk = wall_seconds() - start;
+
+        start = wall_seconds();
+        linked_list thawed = frozen_to_linked_list(&f, NULL);
+        double thaw = wall_seconds() - start;
+        node* temp = l.head;
+        for (node* t = thawed.head; t && temp; t = (*t).next, temp = (*temp).next) ok = ok && (*t).value1 == (*temp).value1;
+        ok = ok && thawed.length == n && !temp && (*thawed.tail).value1 == values[n - 1];
+        linked_list_clear(&thawed);
+
+        int targets[FROZEN_SEARCHES]; // values of the list and values + 1 (mostly not in the list)
+        for (unsigned int s = 0; s < FROZEN_SEARCHES; s++) targets[s] = values[rand() % n] + (int)(s % 2);
+        unsigned int found_list = 0, found_frozen = 0;
+        start = wall_seconds();
+        for (unsigned int s = 0; s < FROZEN_SEARCHES; s++) found_frozen += frozen_value_in(&f, targets[s]) >= 0;
+        double frozen_search = wall_seconds() - start;
+        start = wall_seconds();
+        for (unsigned int s = 0; s < FROZEN_SEARCHES; s++) found_list += linked_list_value_in(&l, targets[s]) != NULL;
+        double list_search = wall_seconds() - start;
+        ok = ok && found_frozen == found_list;
+        for (unsigned int s = 0; s < FROZEN_SEARCHES; s++){
+            node* found = linked_list_value_in(&l, targets[s]);
+            long long position = frozen_value_in(&f, targets[s]);
+            if (found) ok = ok && position == (long long)(found - l.head) && frozen_value_at(&f, (unsigned int)position) == targets[s];
+            else ok = ok && position < 0;
+            ok = ok && frozen_count_frequents(&f, targets[s]) == (unsigned int)linked_list_count_frequents(&l, targets[s]);
+        }
+
+        aggregates frozen = frozen_aggregate(&f, AGGREGATE_ALL, values[n / 2]);
+        aggregates list = aggregate_list(l.head, AGGREGATE_ALL, values[n / 2]);
+        ok = ok && frozen_sum == list_sum && frozen.min == list.min && frozen.max == list.max
+             && frozen.length == list.length && frozen.frequency == list.frequency;
+
+        printf("%s, %u values: frozen %.2f bytes/value, linked list %u bytes/value (%.1fx smaller)\n",
+               sorted ? "sorted" : "random", n, (double)frozen_bytes(&f) / n, (unsigned int)sizeof(node),
+               (double)sizeof(node) * n / frozen_bytes(&f));
+        printf("  create %.2f ns/value, walk: frozen %.2f ns/value, linked list %.2f ns/value, to linked list %.2f ns/value\n",
+               create * 1e9 / n, frozen_walk * 1e9 / n, list_walk * 1e9 / n, thaw * 1e9 / n);
+        printf("  %u searches (%u found): frozen %.3f ms, linked list %.3f ms%s\n", FROZEN_SEARCHES, found_frozen,
+               frozen_search * 1e3, list_search * 1e3, ok ? "" : " (DIFFERENT RESULTS)");
+
+        frozen_clear(&f);
+        clear_arena(a);
+    }
+    free(values);
+    return ok;
+}
+
+
+
+
+// :::::::::::::::::::::::::::::::::::::::::::::::::::::: TESTS ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+/**
+ * @brief Entry point of the program, used for testing
+ * @details Runs the frozen list benchmark (the optional argument is the number of values, default 1000000).
+ * @param argc Number of arguments
+ * @param argv Arguments
+ * @return int 0 if the results are the same, 1 otherwise
+ */
+int main(int argc, char* argv[]){
+    unsigned int n = argc > 1 ? (unsigned int)strtoul(argv[1], NULL, 10) : 1000000;
+    return benchmark_frozen(n) ? 0 : 1;
+
+    /* compiling: gcc frozenList.c -o frozenList -lpthread
+    executing: frozenList [values] */
+}
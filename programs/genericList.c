@@ -0,0 +1,583 @@
+// ::::::::::::::::::::::::::::::::::::::::::::::::: LIBRARIES :::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+/**
+ * @file genericList.c
+ * @author Lorenzo Mercuri
+ * @brief Methods for list manipulation with any type of value
+ * @details DEFINE_LIST writes the nodes and the functions of linkedList.c for a type of value,
+ * with the comparisons written in the code of each function instead of called through a pointer,
+ * so a list of long long, double or struct is as fast as the list of int.
+ * (macros: https://gcc.gnu.org/onlinedocs/cpp/Macros.html
+ * _Generic: https://en.cppreference.com/w/c/language/generic).
+ * linkedList.c is included for the comparison with the list of int
+ */
+#define LINKEDLIST_NO_MAIN
+#include "linkedList.c"
+
+
+
+// :::::::::::::::::::::::::::::::::::::::::::::::::: GENERIC_LIST :::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+/* LIST OF FUNCTIONS (written by DEFINE_LIST(NAME, ...), each one as the function with the same name in linkedList.c):
+    creations:
+        1) NAME_create_node
+        2) NAME_create_list
+    3) NAME_print_list
+    4) NAME_clear_list
+    insertions:
+        5) NAME_insertion_head_node
+        6) NAME_insertion_end_node
+        7) NAME_insertion_after_node
+        8) NAME_insertion_before_node
+    9) NAME_concatenate_lists
+    10) NAME_split_list_at_node
+    11) NAME_split_list_at_value
+    removes:
+        12) NAME_remove_node
+        13) NAME_remove_node_with_value
+    changes:
+        14) NAME_change_node_value
+        15) NAME_change_node_value_with_value
+    16) NAME_is_empty_list
+    in_list:
+        17) NAME_node_in_list
+        18) NAME_value_in_list
+    19) NAME_reverse_list
+    20) NAME_list_length
+    21) NAME_max_list
+    22) NAME_min_list
+    23) NAME_count_frequents_in_list
+    24) NAME_sort_list (bottom-up merge sort, with NAME_merge_runs)
+    25) NAME_list_values */
+
+
+/**
+ * @brief Default comparisons and printing for the arithmetic types
+ * @details LIST_PRINT chooses the printf format from the type of the value with _Generic.
+ * Every type has its own format: there is no default, so a type without one (a struct,
+ * a pointer other than void* and char*) is a compile error instead of a wrong format.
+ * Time complexity: O(1)
+ */
+#define LIST_LESS(a, b) ((a) < (b))
+#define LIST_EQUAL(a, b) ((a) == (b))
+#define LIST_PRINT(a) printf(_Generic((a), \
+    _Bool: "%d", char: "%c", signed char: "%hhd", unsigned char: "%hhu", short: "%hd", unsigned short: "%hu", \
+    int: "%d", unsigned int: "%u", long: "%ld", unsigned long: "%lu", \
+    long long: "%lld", unsigned long long: "%llu", float: "%g", double: "%g", long double: "%Lg", \
+    char*: "%s", const char*: "%s", void*: "%p", const void*: "%p"), (a))
+
+/**
+ * @brief Writes a list of values of a type
+ * @details The functions are static inline: every program can write the lists it needs,
+ * and the unused functions are not compiled.
+ * Time complexity: O(1) (at compile time)
+ * @param NAME Prefix of the types and of the functions (NAME_node, NAME_tuple, NAME_create_node, ...)
+ * @param TYPE Type of the values
+ * @param LESS Macro or function LESS(a, b), true if the value a comes before the value b
+ * @param EQUAL Macro or function EQUAL(a, b), true if the values are equal
+ * @param PRINT Macro or function PRINT(a), prints a value
+ */
+#define DEFINE_LIST(NAME, TYPE, LESS, EQUAL, PRINT) \
+\
+typedef struct NAME##_node{ \
+    TYPE value1; \
+    struct NAME##_node* next; \
+} NAME##_node; \
+\
+typedef struct{ \
+    NAME##_node* node1; \
+    NAME##_node* node2; \
+} NAME##_tuple; \
+\
+static inline NAME##_node* NAME##_create_node(TYPE v1){ \
+    NAME##_node* new_node = (NAME##_node*)malloc(sizeof(NAME##_node)); \
+    if (!new_node) { \
+        printf("Memory allocation failed\n"); \
+        exit(EXIT_FAILURE); /* critical error */ \
+    } \
+    (*new_node).value1 = v1; \
+    (*new_node).next = NULL; \
+    return new_node; \
+} \
+\
+static inline NAME##_node* NAME##_create_list(TYPE values[], unsigned int length){ \
+    if (length == 0 || values == NULL) return NULL; \
+    NAME##_node* head = NAME##_create_node(values[0]); \
+    NAME##_node* temp = head; \
+    for (unsigned int i = 1; i < length; i++){ \
+        (*temp).next = NAME##_create_node(values[i]); \
+        temp = (*temp).next; \
+    } \
+    return head; \
+} \
+\
+static inline void NAME##_print_list(NAME##_node* head){ \
+    if (!head) return; \
+    printf("["); \
+    for (NAME##_node* temp = head; temp; temp = (*temp).next){ \
+        PRINT((*temp).value1); \
+        if ((*temp).next) printf(", "); \
+    } \
+    printf("]"); \
+} \
+\
+static inline void NAME##_clear_list(NAME##_node* head){ \
+    while (head){ \
+        NAME##_node* temp = head; \
+        head = (*head).next; \
+        free(temp); /* deallocate memory */ \
+    } \
+} \
+\
+static inline NAME##_node* NAME##_insertion_head_node(NAME##_node* head, NAME##_node* n){ \
+    if (!n) return head; \
+    (*n).next = head; \
+    return n; \
+} \
+\
+static inline NAME##_node* NAME##_insertion_end_node(NAME##_node* head, NAME##_node* n){ \
+    if (!head) return n; \
+    if (!n) return head; \
+    NAME##_node* temp = head; \
+    while ((*temp).next) temp = (*temp).next; \
+    (*temp).next = n; \
+    return head; \
+} \
+\
+static inline NAME##_node* NAME##_insertion_after_node(NAME##_node* head, NAME##_node* n, NAME##_node* after_n){ \
+    if (!head) return after_n; \
+    if (!after_n || !n) return head; \
+    NAME##_node* temp = head; \
+    while (temp && temp != n) temp = (*temp).next; \
+    if (!temp) return head; \
+    (*after_n).next = (*temp).next; \
+    (*temp).next = after_n; \
+    return head; \
+} \
+\
+static inline NAME##_node* NAME##_insertion_before_node(NAME##_node* head, NAME##_node* n, NAME##_node* before_n){ \
+    if (!head) return before_n; \
+    if (!before_n || !n) return head; \
+    if (n == head) return NAME##_insertion_head_node(head, before_n); \
+    NAME##_node* temp = head; \
+    while ((*temp).next && (*temp).next != n) temp = (*temp).next; \
+    if (!(*temp).next) return head; \
+    (*before_n).next = n; \
+    (*temp).next = before_n; \
+    return head; \
+} \
+\
+static inline NAME##_node* NAME##_concatenate_lists(NAME##_node* head1, NAME##_node* head2){ \
+    return NAME##_insertion_end_node(head1, head2); \
+} \
+\
+static inline NAME##_tuple NAME##_split_list_at_node(NAME##_node* head, NAME##_node* n){ \
+    NAME##_tuple result = {head, NULL}; \
+    NAME##_node* temp = head; \
+    while (temp && temp != n) temp = (*temp).next; \
+    if (!temp) return result; /* n not found */ \
+    result.node2 = (*temp).next; \
+    (*temp).next = NULL; \
+    return result; \
+} \
+\
+static inline NAME##_tuple NAME##_split_list_at_value(NAME##_node* head, TYPE value){ \
+    NAME##_node* temp = head; \
+    while (temp && !EQUAL((*temp).value1, value)) temp = (*temp).next; \
+    if (!temp){ \
+        NAME##_tuple result = {head, NULL}; \
+        return result; \
+    } \
+    return NAME##_split_list_at_node(head, temp); \
+} \
+\
+static inline NAME##_tuple NAME##_remove_node(NAME##_node* head, NAME##_node* n){ \
+    NAME##_tuple result = {head, NULL}; \
+    if (!head || !n) return result; \
+    if (n == head){ \
+        result.node1 = (*head).next; \
+        (*n).next = NULL; \
+        result.node2 = n; \
+        return result; \
+    } \
+    NAME##_node* temp = head; \
+    while ((*temp).next && (*temp).next != n) temp = (*temp).next; \
+    if (!(*temp).next) return result; /* n not found */ \
+    (*temp).next = (*n).next; \
+    (*n).next = NULL; \
+    result.node2 = n; \
+    return result; \
+} \
+\
+static inline NAME##_tuple NAME##_remove_node_with_value(NAME##_node* head, TYPE value){ \
+    NAME##_node* temp = head; \
+    while (temp && !EQUAL((*temp).value1, value)) temp = (*temp).next; \
+    return NAME##_remove_node(head, temp); \
+} \
+\
+static inline NAME##_node* NAME##_change_node_value(NAME##_node* head, NAME##_node* n, TYPE new_value){ \
+    for (NAME##_node* temp = head; temp; temp = (*temp).next) \
+        if (temp == n){ \
+            (*temp).value1 = new_value; \
+            break; \
+        } \
+    return head; \
+} \
+\
+static inline NAME##_node* NAME##_change_node_value_with_value(NAME##_node* head, TYPE value, TYPE new_value){ \
+    for (NAME##_node* temp = head; temp; temp = (*temp).next) \
+        if (EQUAL((*temp).value1, value)){ \
+            (*temp).value1 = new_value; \
+            break; \
+        } \
+    return head; \
+} \
+\
+static inline int NAME##_is_empty_list(NAME##_node* head){ \
+    return !head; \
+} \
+\
+static inline NAME##_tuple NAME##_node_in_list(NAME##_node* head, NAME##_node* n){ \
+    NAME##_tuple result = {head, NULL}; \
+    for (NAME##_node* temp = head; temp && n; temp = (*temp).next) \
+        if (temp == n){ \
+            result.node2 = n; \
+            break; \
+        } \
+    return result; \
+} \
+\
+static inline NAME##_tuple NAME##_value_in_list(NAME##_node* head, TYPE value){ \
+    NAME##_tuple result = {head, NULL}; \
+    for (NAME##_node* temp = head; temp; temp = (*temp).next) \
+        if (EQUAL((*temp).value1, value)){ \
+            result.node2 = temp; \
+            break; \
+        } \
+    return result; \
+} \
+\
+static inline NAME##_node* NAME##_reverse_list(NAME##_node* head){ \
+    NAME##_node* prev = NULL; \
+    while (head){ \
+        NAME##_node* next = (*head).next; \
+        (*head).next = prev; \
+        prev = head; \
+        head = next; \
+    } \
+    return prev; \
+} \
+\
+static inline int NAME##_list_length(NAME##_node* head){ \
+    int length = 0; \
+    for (; head; head = (*head).next) length++; \
+    return length; \
+} \
+\
+static inline TYPE NAME##_max_list(NAME##_node* head){ \
+    TYPE max = {0}; /* default value of an empty list */ \
+    if (head) max = (*head).value1; \
+    for (NAME##_node* temp = head; temp; temp = (*temp).next) \
+        if (LESS(max, (*temp).value1)) max = (*temp).value1; \
+    return max; \
+} \
+\
+static inline TYPE NAME##_min_list(NAME##_node* head){ \
+    TYPE min = {0}; /* default value of an empty list */ \
+    if (head) min = (*head).value1; \
+    for (NAME##_node* temp = head; temp; temp = (*temp).next) \
+        if (LESS((*temp).value1, min)) min = (*temp).value1; \
+    return min; \
+} \
+\
+static inline int NAME##_count_frequents_in_list(NAME##_node* head, TYPE value){ \
+    int count = 0; \
+    for (NAME##_node* temp = head; temp; temp = (*temp).next) count += EQUAL((*temp).value1, value) ? 1 : 0; \
+    return count; \
+} \
+\
+static inline NAME##_node* NAME##_merge_runs(NAME##_node* head1, NAME##_node* head2){ \
+    NAME##_node merged; /* placeholder before the first node */ \
+    NAME##_node* last = &merged; \
+    while (head1 && head2){ \
+        if (LESS((*head2).value1, (*head1).value1)){ \
+            (*last).next = head2; \
+            head2 = (*head2).next; \
+        } else { \
+            (*last).next = head1; \
+            head1 = (*head1).next; \
+        } \
+        last = (*last).next; \
+    } \
+    (*last).next = head1 ? head1 : head2; \
+    return merged.next; \
+} \
+\
+static inline NAME##_node* NAME##_sort_list(NAME##_node* head){ \
+    if (!head || !(*head).next) return head; \
+    NAME##_node* slots[SORT_SLOTS] = {NULL}; \
+    while (head){ \
+        NAME##_node* run = head; \
+        head = (*head).next; \
+        (*run).next = NULL; \
+        int i = 0; \
+        for (; i < SORT_SLOTS - 1 && slots[i]; i++){ \
+            run = NAME##_merge_runs(slots[i], run); \
+            slots[i] = NULL; \
+        } \
+        slots[i] = slots[i] ? NAME##_merge_runs(slots[i], run) : run; \
+    } \
+    NAME##_node* sorted = NULL; \
+    for (int i = 0; i < SORT_SLOTS; i++) \
+        if (slots[i]) sorted = NAME##_merge_runs(slots[i], sorted); \
+    return sorted; \
+} \
+\
+static inline TYPE* NAME##_list_values(NAME##_node* head){ \
+    if (!head) return NULL; \
+    int length = NAME##_list_length(head); \
+    TYPE* values = (TYPE*)malloc((size_t)length * sizeof(TYPE)); \
+    if (!values) { \
+        printf("Memory allocation failed\n"); \
+        exit(EXIT_FAILURE); /* critical error */ \
+    } \
+    int i = 0; \
+    for (NAME##_node* temp = head; temp; temp = (*temp).next) values[i++] = (*temp).value1; \
+    return values; \
+}
+
+
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::: INSTANCES :::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+/**
+ * @struct point
+ * @brief Represent a point of the plane, example of a struct value ordered by x and then by y
+ * Time complexity: O(1)
+ */
+typedef struct{
+    double x;
+    double y;
+} point;
+
+#define POINT_LESS(a, b) ((a).x < (b).x || ((a).x == (b).x && (a).y < (b).y))
+#define POINT_EQUAL(a, b) ((a).x == (b).x && (a).y == (b).y)
+#define POINT_PRINT(a) printf("(%g, %g)", (a).x, (a).y)
+
+DEFINE_LIST(long_list, long long, LIST_LESS, LIST_EQUAL, LIST_PRINT)
+DEFINE_LIST(double_list, double, LIST_LESS, LIST_EQUAL, LIST_PRINT)
+DEFINE_LIST(point_list, point, POINT_LESS, POINT_EQUAL, POINT_PRINT)
+
+
+/**
+ * @brief Compares two long long through pointers, as a qsort comparator
+ * @details Used by the callback list of the benchmark.
+ * Time complexity: O(1)
+ * @param a Pointer to the first value
+ * @param b Pointer to the second value
+ * @return int Negative, zero or positive if a is less, equal or greater than b
+ */
+int compare_long(const void* a, const void* b){
+    long long x = *(const long long*)a, y = *(const long long*)b;
+    return (x > y) - (x < y);
+}
+
+int (*volatile list_compare)(const void*, const void*) = compare_long; // volatile: a real call for each comparison
+
+#define CALLBACK_LESS(a, b) (list_compare(&(a), &(b)) < 0)
+#define CALLBACK_EQUAL(a, b) (list_compare(&(a), &(b)) == 0)
+
+DEFINE_LIST(callback_list, long long, CALLBACK_LESS, CALLBACK_EQUAL, LIST_PRINT)
+
+
+
+// :::::::::::::::::::::::::::::::::::::::::::::::::: BENCHMARKS :::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+/**
+ * @brief Compares the lists written by DEFINE_LIST with the list of int and with a comparator called through a pointer
+ * @details Random values. Prints ns/node of max and count_frequents (nodes still in order in memory)
+ * and of sort for the list of int (linkedList.c),
+ * long_list, callback_list (long long compared by compare_long through a pointer) and point_list.
+ * Time complexity: O(n log n)
+ * @param n Number of nodes of the lists
+ * @return void Doesn't return a value
+ */
+void benchmark_generic(unsigned int n){
+    if (n == 0) return;
+    int* ints = benchmark_values(n);
+    long long* longs = (long long*)malloc(n * sizeof(long long));
+    point* points = (point*)malloc(n * sizeof(point));
+    if (!longs || !points) {
+        printf("Memory allocation failed\n");
+        exit(EXIT_FAILURE); // critical error
+    }
+    srand(12345);
+    for (unsigned int i = 0; i < n; i++){
+        ints[i] = rand();
+        longs[i] = ints[i];
+        points[i].x = ints[i] % 1000;
+        points[i].y = ints[i] / 1000;
+    }
+    long long sink = 0;
+    double times[4][3];
+
+    arena* a = create_arena(0); // nodes in order in memory, as the other lists
+    node* int_head = arena_create_list(a, ints, n);
+    long_list_node* long_head = long_list_create_list(longs, n);
+    callback_list_node* callback_head = callback_list_create_list(longs, n);
+    point_list_node* point_head = point_list_create_list(points, n);
+
+    clock_t start = clock();
+    sink += max_list(int_head);
+    times[0][0] = ns_per_element(start, n);
+    start = clock();
+    sink += count_frequents_in_list(int_head, ints[0]);
+    times[0][1] = ns_per_element(start, n);
+    start = clock();
+    int_head = sort_list(int_head);
+    times[0][2] = ns_per_element(start, n);
+
+    start = clock();
+    sink += long_list_max_list(long_head);
+    times[1][0] = ns_per_element(start, n);
+    start = clock();
+    sink += long_list_count_frequents_in_list(long_head, longs[0]);
+    times[1][1] = ns_per_element(start, n);
+    start = clock();
+    long_head = long_list_sort_list(long_head);
+    times[1][2] = ns_per_element(start, n);
+
+    start = clock();
+    sink += callback_list_max_list(callback_head);
+    times[2][0] = ns_per_element(start, n);
+    start = clock();
+    sink += callback_list_count_frequents_in_list(callback_head, longs[0]);
+    times[2][1] = ns_per_element(start, n);
+    start = clock();
+    callback_head = callback_list_sort_list(callback_head);
+    times[2][2] = ns_per_element(start, n);
+
+    start = clock();
+    sink += (long long)point_list_max_list(point_head).x;
+    times[3][0] = ns_per_element(start, n);
+    start = clock();
+    sink += point_list_count_frequents_in_list(point_head, points[0]);
+    times[3][1] = ns_per_element(start, n);
+    start = clock();
+    point_head = point_list_sort_list(point_head);
+    times[3][2] = ns_per_element(start, n);
+
+    const char* names[] = {"int (linkedList.c)", "long_list", "callback_list", "point_list"};
+    for (int k = 0; k < 4; k++)
+        printf("%s: max %.2f, count %.2f, sort %.2f ns/node\n", names[k], times[k][0], times[k][1], times[k][2]);
+    printf("(checksum %lld)\n", sink);
+
+    clear_arena(a);
+    long_list_clear_list(long_head);
+    callback_list_clear_list(callback_head);
+    point_list_clear_list(point_head);
+    free(ints);
+    free(longs);
+    free(points);
+}
+
+
+
+// :::::::::::::::::::::::::::::::::::::::::::::::::::::: TESTS ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+/**
+ * @brief Tests the functions written by DEFINE_LIST for long long values
+ * @details On 7 values with duplicates: length, max, min and frequency, sort (checked with list_values),
+ * remove of a value, split at a value, change of a value, value_in_list and reverse.
+ * Time complexity: O(1)
+ * @return int 1 if the test passes, 0 otherwise
+ */
+int test_long_list(){
+    long long values[7] = {5, -3, 9, 5, 0, 12, 5};
+    long long sorted[7] = {-3, 0, 5, 5, 5, 9, 12};
+    long_list_node* head = long_list_create_list(values, 7);
+    int passed = long_list_list_length(head) == 7 && long_list_max_list(head) == 12 && long_list_min_list(head) == -3;
+    passed = passed && long_list_count_frequents_in_list(head, 5) == 3 && long_list_count_frequents_in_list(head, 4) == 0;
+
+    head = long_list_sort_list(head);
+    long long* got = long_list_list_values(head);
+    for (int i = 0; i < 7; i++) passed = passed && got[i] == sorted[i];
+    free(got);
+
+    long_list_tuple removed = long_list_remove_node_with_value(head, -3); // the head
+    head = removed.node1;
+    passed = passed && removed.node2 && (*removed.node2).value1 == -3 && !(*removed.node2).next;
+    passed = passed && long_list_list_length(head) == 6 && (*head).value1 == 0;
+    free(removed.node2);
+    removed = long_list_remove_node_with_value(head, 42); // not in the list
+    passed = passed && removed.node1 == head && !removed.node2;
+
+    long_list_tuple parts = long_list_split_list_at_value(head, 9); // 0 5 5 5 9 | 12
+    passed = passed && long_list_list_length(parts.node1) == 5 && parts.node2 && (*parts.node2).value1 == 12;
+    passed = passed && long_list_list_length(parts.node2) == 1;
+    head = long_list_concatenate_lists(parts.node1, parts.node2);
+
+    head = long_list_change_node_value_with_value(head, 5, 7); // the first 5 only
+    passed = passed && long_list_count_frequents_in_list(head, 5) == 2 && long_list_value_in_list(head, 7).node2;
+    head = long_list_reverse_list(head); // 12 9 5 5 7 0
+    passed = passed && (*head).value1 == 12 && long_list_list_length(head) == 6;
+    printf("long_list: %s\n", passed ? "passed" : "FAILED");
+    long_list_clear_list(head);
+    return passed;
+}
+
+/**
+ * @brief Tests the functions written by DEFINE_LIST for point values (a struct)
+ * @details Sorts points by x and then by y, checks max, min, frequency and value_in_list with POINT_EQUAL,
+ * inserts a point before and after nodes and removes a node in the middle.
+ * Time complexity: O(1)
+ * @return int 1 if the test passes, 0 otherwise
+ */
+int test_point_list(){
+    point values[5] = {{1, 2}, {0, 5}, {1, -1}, {0, 5}, {-2, 0}};
+    point sorted[5] = {{-2, 0}, {0, 5}, {0, 5}, {1, -1}, {1, 2}};
+    point_list_node* head = point_list_sort_list(point_list_create_list(values, 5));
+    int i = 0, passed = 1;
+    for (point_list_node* temp = head; temp; temp = (*temp).next, i++)
+        passed = passed && i < 5 && POINT_EQUAL((*temp).value1, sorted[i]);
+    passed = passed && i == 5;
+
+    point max = point_list_max_list(head), min = point_list_min_list(head);
+    passed = passed && POINT_EQUAL(max, sorted[4]) && POINT_EQUAL(min, sorted[0]);
+    passed = passed && point_list_count_frequents_in_list(head, values[1]) == 2;
+    point missing = {3, 3};
+    passed = passed && !point_list_value_in_list(head, missing).node2;
+
+    point_list_node* middle = point_list_value_in_list(head, values[2]).node2; // (1, -1)
+    head = point_list_insertion_before_node(head, middle, point_list_create_node(missing));
+    head = point_list_insertion_after_node(head, middle, point_list_create_node(missing));
+    passed = passed && point_list_list_length(head) == 7 && point_list_count_frequents_in_list(head, missing) == 2;
+    point_list_tuple removed = point_list_remove_node(head, middle);
+    head = removed.node1;
+    passed = passed && removed.node2 == middle && point_list_list_length(head) == 6;
+    passed = passed && !point_list_node_in_list(head, middle).node2;
+    free(middle);
+    printf("point_list: %s\n", passed ? "passed" : "FAILED");
+    point_list_clear_list(head);
+    return passed;
+}
+
+
+/**
+ * @brief Entry point of the program, used for testing
+ * @details Runs the tests, prints a small list of doubles, then runs the benchmark
+ * (the optional argument is the number of nodes, default 1000000).
+ * @return 0 if the tests pass, 1 otherwise
+ */
+int main(int argc, char* argv[]){
+    int passed = test_long_list();
+    passed = test_point_list() && passed;
+
+    double d[] = {2.5, -1, 3.25};
+    double_list_node* doubles = double_list_sort_list(double_list_create_list(d, 3));
+    double_list_print_list(doubles);
+    printf("\n");
+    double_list_clear_list(doubles);
+
+    unsigned int n = argc > 1 ? (unsigned int)strtoul(argv[1], NULL, 10) : 1000000;
+    benchmark_generic(n);
+    return passed ? 0 : 1;
+
+    /* compiling: gcc genericList.c -o genericList -lpthread
+    executing: genericList [nodes] */
+}
@@ -0,0 +1,945 @@
+// ::::::::::::::::::::::::::::::::::::::::::::::::: LIBRARIES :::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+/**
+ * @file indexedList.c
+ * @author Lorenzo Mercuri
+ * @brief Methods for indexed list manipulation
+ * @details A linked_list with two hash tables, so searching, counting, removing and changing by value don't walk the list.
+ * The table of the nodes, keyed by the address of the node, stores the node before each node,
+ * so removals and insertions before a node are O(1) too, and links the nodes with the same value in a chain.
+ * The table of the values has one slot for each distinct value, with the number of its nodes and the first of them:
+ * the operations stay O(1) expected however many nodes have the same value.
+ * Both tables use open addressing with linear probing.
+ * (open addressing: https://en.wikipedia.org/wiki/Open_addressing
+ * linear probing and deletion: https://en.wikipedia.org/wiki/Linear_probing#Deletion).
+ * linkedList.c is included for the nodes and the linked_list descriptor
+ */
+#define LINKEDLIST_NO_MAIN
+#include "linkedList.c"
+#include <stdint.h> // uintptr_t
+
+
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::: INDEXED_LIST ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+/* LIST OF FUNCTIONS:
+    index (hash tables of the nodes and of the values):
+        1) index_home
+        2) index_node_home
+        3) index_find_node
+        4) index_find_value
+        5) index_insert_node_slot
+        6) index_insert_value_slot
+        7) index_add
+        8) index_delete
+        9) index_set_prev
+    10) indexed_create_list
+    11) indexed_clear_list
+    insertions:
+        12) indexed_insertion_head_node
+        13) indexed_insertion_end_node
+        14) indexed_insertion_after_node
+        15) indexed_insertion_before_node
+    16) indexed_concatenate
+    17) indexed_split_at_node
+    18) indexed_split_at_value
+    removes:
+        19) indexed_remove_node
+        20) indexed_remove_node_with_value
+    changes:
+        21) indexed_change_node_value
+        22) indexed_change_node_value_with_value
+    in_list:
+        23) indexed_node_in
+        24) indexed_value_in
+    25) indexed_count_frequents
+    26) indexed_memory */
+
+
+#define INDEX_MIN_CAPACITY 16
+#define INDEX_MAX_LOAD 2 // a table doubles when it would be more than 1/INDEX_MAX_LOAD full
+
+/**
+ * @struct index_node_slot
+ * @brief Represent a slot of the table of the nodes of an indexed list
+ * @details It has a node of the list (the key, hashed by its address), the node before it in the list
+ * and the nodes before and after it in the chain of the nodes with the same value.
+ * Time complexity: O(1)
+ */
+typedef struct{
+    node* n; // NULL if the slot is empty
+    node* prev; // NULL if n is the head
+    node* same_prev; // NULL if n is the first node of the chain of its value
+    node* same_next; // NULL if n is the last node of the chain of its value
+} index_node_slot;
+
+/**
+ * @struct index_value_slot
+ * @brief Represent a slot of the table of the values of an indexed list
+ * @details It has a value (the key), the number of nodes with the value and the first node of their chain.
+ * Time complexity: O(1)
+ */
+typedef struct{
+    node* first; // NULL if the slot is empty
+    int value;
+    unsigned int count;
+} index_value_slot;
+
+/**
+ * @struct index_node_table
+ * @brief Represent the hash table of the nodes of an indexed list
+ * @details Time complexity: O(1)
+ */
+typedef struct{
+    index_node_slot* slots;
+    unsigned int capacity; // power of 2
+    unsigned int used;
+} index_node_table;
+
+/**
+ * @struct index_value_table
+ * @brief Represent the hash table of the values of an indexed list
+ * @details Time complexity: O(1)
+ */
+typedef struct{
+    index_value_slot* slots;
+    unsigned int capacity; // power of 2
+    unsigned int used;
+} index_value_table;
+
+/**
+ * @struct indexed_list
+ * @brief Represent an indexed linked list
+ * @details It has the linked list, the table of its nodes and the table of its values.
+ * The values must be changed only with the indexed functions, or the tables are no longer valid.
+ * Time complexity: O(1)
+ */
+typedef struct{
+    linked_list list;
+    index_node_table nodes;
+    index_value_table values;
+} indexed_list;
+
+
+/**
+ * @brief First slot to probe for a value
+ * @details Multiplicative hashing, with the high bits folded into the low ones.
+ * Time complexity: O(1)
+ * @param value The value
+ * @param capacity Number of slots (power of 2)
+ * @return unsigned int Index of the slot
+ */
+unsigned int index_home(int value, unsigned int capacity){
+    unsigned int h = (unsigned int)value * 2654435761u; // Knuth's multiplicative constant
+    return (h ^ (h >> 16)) & (capacity - 1);
+}
+
+/**
+ * @brief First slot to probe for a node
+ * @details The address is mixed with the finalizer of MurmurHash3, so every bit of it changes the low bits
+ * (the addresses of the nodes are multiples of the alignment and often a fixed distance apart).
+ * Time complexity: O(1)
+ * @param n Pointer to the node
+ * @param capacity Number of slots (power of 2)
+ * @return unsigned int Index of the slot
+ */
+unsigned int index_node_home(node* n, unsigned int capacity){
+    unsigned long long h = (unsigned long long)(uintptr_t)n;
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdull;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ull;
+    h ^= h >> 33;
+    return (unsigned int)h & (capacity - 1);
+}
+
+
+/**
+ * @brief Finds the slot of a node
+ * @details Time complexity: O(1) expected
+ * @param l Pointer to the indexed list
+ * @param n Pointer to the node
+ * @return index_node_slot* Pointer to the slot, NULL if the node is not in the list
+ */
+index_node_slot* index_find_node(indexed_list* l, node* n){
+    if (!l || !n || !(*l).nodes.slots) return NULL;
+
+    unsigned int mask = (*l).nodes.capacity - 1;
+    for (unsigned int i = index_node_home(n, (*l).nodes.capacity); (*l).nodes.slots[i].n; i = (i + 1) & mask)
+        if ((*l).nodes.slots[i].n == n) return &(*l).nodes.slots[i];
+    return NULL;
+}
+
+/**
+ * @brief Finds the slot of a value
+ * @details Time complexity: O(1) expected
+ * @param l Pointer to the indexed list
+ * @param value The value
+ * @return index_value_slot* Pointer to the slot, NULL if the value is not in the list
+ */
+index_value_slot* index_find_value(indexed_list* l, int value){
+    if (!l || !(*l).values.slots) return NULL;
+
+    unsigned int mask = (*l).values.capacity - 1;
+    for (unsigned int i = index_home(value, (*l).values.capacity); (*l).values.slots[i].first; i = (i + 1) & mask)
+        if ((*l).values.slots[i].value == value) return &(*l).values.slots[i];
+    return NULL;
+}
+
+
+/**
+ * @brief Puts a slot in the table of the nodes
+ * @details Doubles the table (rehashing every slot) when it would be too full.
+ * The pointers to the slots of the nodes are no longer valid after this call.
+ * Time complexity: O(1) amortized
+ * @warning If memory allocation fails prints an error and exit program
+ * @param l Pointer to the indexed list
+ * @param slot The slot, with a node not in the table
+ * @return void Doesn't return a value
+ */
+void index_insert_node_slot(indexed_list* l, index_node_slot slot){
+    index_node_table* t = &(*l).nodes;
+    if (((*t).used + 1) * INDEX_MAX_LOAD > (*t).capacity){
+        index_node_slot* old = (*t).slots;
+        unsigned int old_capacity = (*t).capacity;
+        (*t).capacity = old_capacity ? old_capacity * 2 : INDEX_MIN_CAPACITY;
+        (*t).slots = (index_node_slot*)calloc((*t).capacity, sizeof(index_node_slot));
+        if (!(*t).slots) {
+            printf("Memory allocation failed\n");
+            exit(EXIT_FAILURE); // critical error
+        }
+        (*t).used = 0;
+        for (unsigned int i = 0; i < old_capacity; i++) if (old[i].n) index_insert_node_slot(l, old[i]);
+        free(old);
+    }
+
+    unsigned int mask = (*t).capacity - 1;
+    unsigned int i = index_node_home(slot.n, (*t).capacity);
+    while ((*t).slots[i].n) i = (i + 1) & mask;
+    (*t).slots[i] = slot;
+    (*t).used++;
+}
+
+/**
+ * @brief Puts a slot in the table of the values
+ * @details Doubles the table (rehashing every slot) when it would be too full.
+ * The pointers to the slots of the values are no longer valid after this call.
+ * Time complexity: O(1) amortized
+ * @warning If memory allocation fails prints an error and exit program
+ * @param l Pointer to the indexed list
+ * @param slot The slot, with a value not in the table
+ * @return void Doesn't return a value
+ */
+void index_insert_value_slot(indexed_list* l, index_value_slot slot){
+    index_value_table* t = &(*l).values;
+    if (((*t).used + 1) * INDEX_MAX_LOAD > (*t).capacity){
+        index_value_slot* old = (*t).slots;
+        unsigned int old_capacity = (*t).capacity;
+        (*t).capacity = old_capacity ? old_capacity * 2 : INDEX_MIN_CAPACITY;
+        (*t).slots = (index_value_slot*)calloc((*t).capacity, sizeof(index_value_slot));
+        if (!(*t).slots) {
+            printf("Memory allocation failed\n");
+            exit(EXIT_FAILURE); // critical error
+        }
+        (*t).used = 0;
+        for (unsigned int i = 0; i < old_capacity; i++) if (old[i].first) index_insert_value_slot(l, old[i]);
+        free(old);
+    }
+
+    unsigned int mask = (*t).capacity - 1;
+    unsigned int i = index_home(slot.value, (*t).capacity);
+    while ((*t).slots[i].first) i = (i + 1) & mask;
+    (*t).slots[i] = slot;
+    (*t).used++;
+}
+
+
+/**
+ * @brief Adds a node to the tables
+ * @details The node becomes the first of the chain of its value (the slot of the value is added if it is new).
+ * The pointers to the slots are no longer valid after this call.
+ * Time complexity: O(1) amortized
+ * @warning If memory allocation fails prints an error and exit program
+ * @param l Pointer to the indexed list
+ * @param n Pointer to the node
+ * @param prev Pointer to the node before n (NULL if n is the head)
+ * @return void Doesn't return a value
+ */
+void index_add(indexed_list* l, node* n, node* prev){
+    index_value_slot* value = index_find_value(l, (*n).value1);
+    node* same_next = value ? (*value).first : NULL;
+    if (value){
+        (*value).first = n;
+        (*value).count++;
+        (*index_find_node(l, same_next)).same_prev = n;
+    } else {
+        index_value_slot slot = {n, (*n).value1, 1};
+        index_insert_value_slot(l, slot);
+    }
+
+    index_node_slot slot = {n, prev, NULL, same_next};
+    index_insert_node_slot(l, slot);
+}
+
+/**
+ * @brief Removes a node from the tables
+ * @details The node leaves the chain of its value (and the slot of the value goes with the last node).
+ * Backward shift deletion: the following slots of the cluster move back if their home allows it,
+ * so there are no deleted markers and the searches stay short.
+ * The pointers to the slots are no longer valid after this call.
+ * Time complexity: O(1) expected
+ * @param l Pointer to the indexed list
+ * @param slot Pointer to the slot of the node
+ * @return void Doesn't return a value
+ */
+void index_delete(indexed_list* l, index_node_slot* slot){
+    node* same_prev = (*slot).same_prev;
+    node* same_next = (*slot).same_next;
+    if (same_next) (*index_find_node(l, same_next)).same_prev = same_prev;
+    if (same_prev) (*index_find_node(l, same_prev)).same_next = same_next;
+
+    index_value_slot* value = index_find_value(l, (*(*slot).n).value1);
+    if (!same_prev) (*value).first = same_next;
+    if (--(*value).count == 0){
+        unsigned int mask = (*l).values.capacity - 1;
+        unsigned int i = (unsigned int)(value - (*l).values.slots);
+        for (unsigned int j = (i + 1) & mask; (*l).values.slots[j].first; j = (j + 1) & mask){
+            unsigned int home = index_home((*l).values.slots[j].value, (*l).values.capacity);
+            if (((j - home) & mask) >= ((j - i) & mask)){ // the home of j is not between i and j
+                (*l).values.slots[i] = (*l).values.slots[j];
+                i = j;
+            }
+        }
+        (*l).values.slots[i].first = NULL;
+        (*l).values.used--;
+    }
+
+    unsigned int mask = (*l).nodes.capacity - 1;
+    unsigned int i = (unsigned int)(slot - (*l).nodes.slots);
+    for (unsigned int j = (i + 1) & mask; (*l).nodes.slots[j].n; j = (j + 1) & mask){
+        unsigned int home = index_node_home((*l).nodes.slots[j].n, (*l).nodes.capacity);
+        if (((j - home) & mask) >= ((j - i) & mask)){ // the home of j is not between i and j
+            (*l).nodes.slots[i] = (*l).nodes.slots[j];
+            i = j;
+        }
+    }
+    (*l).nodes.slots[i].n = NULL;
+    (*l).nodes.used--;
+}
+
+/**
+ * @brief Changes the node before a node in the table of the nodes
+ * @details Time complexity: O(1) expected
+ * @param l Pointer to the indexed list
+ * @param n Pointer to the node (nothing is done if NULL)
+ * @param prev Pointer to the new node before n
+ * @return void Doesn't return a value
+ */
+void index_set_prev(indexed_list* l, node* n, node* prev){
+    index_node_slot* slot = index_find_node(l, n);
+    if (slot) (*slot).prev = prev;
+}
+
+
+/**
+ * @brief Create a new indexed linked list
+ * @details Time complexity: O(n), n = number of values
+ * @warning If memory allocation fails prints an error and exit program
+ * @param values Array of values to initialize the list
+ * @param length Number of elements in the values array
+ * @return indexed_list The new list.
+ * If the argument is NULL or the length is zero returns an empty list
+ */
+indexed_list indexed_create_list(int values[], unsigned int length){
+    indexed_list l = {linked_list_create(values, length), {NULL, 0, 0}, {NULL, 0, 0}};
+    if (!l.list.head) return l;
+
+    // the table of the nodes gets its final capacity at once, so it isn't rehashed while the list is added
+    unsigned int capacity = INDEX_MIN_CAPACITY;
+    while (capacity / INDEX_MAX_LOAD < length) capacity *= 2;
+    l.nodes.slots = (index_node_slot*)calloc(capacity, sizeof(index_node_slot));
+    if (!l.nodes.slots){
+        printf("Memory allocation failed\n");
+        exit(EXIT_FAILURE); // critical error
+    }
+    l.nodes.capacity = capacity;
+
+    node* prev = NULL;
+    for (node* temp = l.list.head; temp; temp = (*temp).next){
+        index_add(&l, temp, prev);
+        prev = temp;
+    }
+    return l;
+}
+
+
+/**
+ * @brief Frees the memory allocated for an indexed linked list
+ * @details The nodes and the tables are freed, the list becomes empty.
+ * Time complexity: O(n), n = number of nodes in the list
+ * @param l Pointer to the indexed list
+ * @return void Doesn't return a value
+ */
+void indexed_clear_list(indexed_list* l){
+    if (!l) return;
+
+    linked_list_clear(&(*l).list);
+    free((*l).nodes.slots);
+    free((*l).values.slots);
+    (*l).nodes.slots = NULL;
+    (*l).values.slots = NULL;
+    (*l).nodes.capacity = (*l).nodes.used = (*l).values.capacity = (*l).values.used = 0;
+}
+
+
+/**
+ * @brief Insert a node at the head of an indexed linked list
+ * @details Time complexity: O(1) amortized
+ * @param l Pointer to the indexed list
+ * @param n Pointer to the node to be inserted (not in a list)
+ * @return void Doesn't return a value
+ */
+void indexed_insertion_head_node(indexed_list* l, node* n){
+    if (!l || !n) return;
+
+    index_set_prev(l, (*l).list.head, n);
+    linked_list_insertion_head_node(&(*l).list, n);
+    index_add(l, n, NULL);
+}
+
+/**
+ * @brief Insert a node at the end of an indexed linked list
+ * @details Time complexity: O(1) amortized
+ * @param l Pointer to the indexed list
+ * @param n Pointer to the node to be inserted (not in a list)
+ * @return void Doesn't return a value
+ */
+void indexed_insertion_end_node(indexed_list* l, node* n){
+    if (!l || !n) return;
+
+    node* prev = (*l).list.tail;
+    linked_list_insertion_end_node(&(*l).list, n);
+    index_add(l, n, prev);
+}
+
+/**
+ * @brief Insert a node after another node of an indexed linked list
+ * @details Time complexity: O(1) amortized
+ * @param l Pointer to the indexed list
+ * @param n Pointer to the node after which the new node will be inserted
+ * @param after_n Pointer to the node to be inserted (not in a list)
+ * @return int 1 if the node is inserted, 0 if n is not in the list
+ */
+int indexed_insertion_after_node(indexed_list* l, node* n, node* after_n){
+    if (!l || !after_n || !index_find_node(l, n)) return 0;
+
+    (*after_n).next = (*n).next;
+    (*n).next = after_n;
+    if (n == (*l).list.tail) (*l).list.tail = after_n;
+    (*l).list.length++;
+    index_set_prev(l, (*after_n).next, after_n);
+    index_add(l, after_n, n);
+    return 1;
+}
+
+/**
+ * @brief Insert a node before another node of an indexed linked list
+ * @details The node before n is in the table, so the list is not walked.
+ * Time complexity: O(1) amortized
+ * @param l Pointer to the indexed list
+ * @param n Pointer to the node before which the new node will be inserted
+ * @param before_n Pointer to the node to be inserted (not in a list)
+ * @return int 1 if the node is inserted, 0 if n is not in the list
+ */
+int indexed_insertion_before_node(indexed_list* l, node* n, node* before_n){
+    index_node_slot* slot = index_find_node(l, n);
+    if (!slot || !before_n) return 0;
+
+    node* prev = (*slot).prev;
+    (*slot).prev = before_n;
+    (*before_n).next = n;
+    if (prev) (*prev).next = before_n;
+    else (*l).list.head = before_n;
+    (*l).list.length++;
+    index_add(l, before_n, prev);
+    return 1;
+}
+
+
+/**
+ * @brief Concatenates two indexed linked lists
+ * @details Links the head of the second list after the tail of the first list,
+ * the second list becomes empty.
+ * The nodes of the shorter list move into the tables of the longer one, which are kept by l1.
+ * Time complexity: O(min(n, m)) amortized, n and m = number of nodes in the lists
+ * @param l1 Pointer to the first indexed list
+ * @param l2 Pointer to the second indexed list
+ * @return void Doesn't return a value
+ */
+void indexed_concatenate(indexed_list* l1, indexed_list* l2){
+    if (!l1 || !l2 || l1 == l2 || !(*l2).list.head) return;
+
+    if ((*l1).nodes.used < (*l2).nodes.used){ // swap the tables, then move the nodes of l1
+        index_node_table nodes = (*l1).nodes;
+        index_value_table values = (*l1).values;
+        (*l1).nodes = (*l2).nodes;
+        (*l1).values = (*l2).values;
+        (*l2).nodes = nodes;
+        (*l2).values = values;
+    }
+    for (unsigned int i = 0; i < (*l2).nodes.capacity; i++)
+        if ((*l2).nodes.slots[i].n) index_add(l1, (*l2).nodes.slots[i].n, (*l2).nodes.slots[i].prev);
+    free((*l2).nodes.slots);
+    free((*l2).values.slots);
+    index_node_table no_nodes = {NULL, 0, 0};
+    index_value_table no_values = {NULL, 0, 0};
+    (*l2).nodes = no_nodes;
+    (*l2).values = no_values;
+
+    index_set_prev(l1, (*l2).list.head, (*l1).list.tail);
+    linked_list_concatenate(&(*l1).list, &(*l2).list);
+}
+
+
+/**
+ * @brief Splits an indexed linked list in two at a specified node
+ * @details The first part (kept in l) includes all nodes up to and including the specified node,
+ * and the second part includes all nodes after it, moved to new tables.
+ * Time complexity: O(m) amortized, m = number of nodes after the specified node
+ * @param l Pointer to the indexed list
+ * @param n Pointer to the node at which the list will be split
+ * @return indexed_list The second part of the list.
+ * If the specified node is not found, the second part is empty
+ */
+indexed_list indexed_split_at_node(indexed_list* l, node* n){
+    indexed_list second = {{NULL, NULL, 0}, {NULL, 0, 0}, {NULL, 0, 0}};
+    if (!index_find_node(l, n) || n == (*l).list.tail) return second;
+
+    node* prev = NULL;
+    unsigned int moved = 0;
+    for (node* temp = (*n).next; temp; temp = (*temp).next){
+        index_delete(l, index_find_node(l, temp));
+        index_add(&second, temp, prev);
+        prev = temp;
+        moved++;
+    }
+
+    second.list.head = (*n).next;
+    second.list.tail = (*l).list.tail;
+    second.list.length = moved;
+    (*n).next = NULL;
+    (*l).list.tail = n;
+    (*l).list.length -= moved;
+    return second;
+}
+
+/**
+ * @brief Splits an indexed linked list in two at a specified value
+ * @details As indexed_split_at_node on the first node of the chain of the value
+ * (if more nodes have the value, the last one added, not always the first one in the list).
+ * Time complexity: O(m) amortized, m = number of nodes after the node with the value
+ * @param l Pointer to the indexed list
+ * @param value Value of the node at which the list will be split
+ * @return indexed_list The second part of the list.
+ * If the specified value is not found, the second part is empty
+ */
+indexed_list indexed_split_at_value(indexed_list* l, int value){
+    index_value_slot* slot = index_find_value(l, value);
+    if (!slot){
+        indexed_list second = {{NULL, NULL, 0}, {NULL, 0, 0}, {NULL, 0, 0}};
+        return second;
+    }
+    return indexed_split_at_node(l, (*slot).first);
+}
+
+
+/**
+ * @brief Remove a node of an indexed linked list
+ * @details The node before n is in the table, so the list is not walked.
+ * Time complexity: O(1) expected
+ * @param l Pointer to the indexed list
+ * @param n Pointer to the node to be removed
+ * @return node* Pointer to the removed node.
+ * If the node is not found returns NULL
+ */
+node* indexed_remove_node(indexed_list* l, node* n){
+    index_node_slot* slot = index_find_node(l, n);
+    if (!slot) return NULL;
+
+    node* prev = (*slot).prev;
+    if (prev) (*prev).next = (*n).next;
+    else (*l).list.head = (*n).next;
+    if (n == (*l).list.tail) (*l).list.tail = prev;
+    (*l).list.length--;
+    index_set_prev(l, (*n).next, prev);
+    index_delete(l, slot);
+    (*n).next = NULL;
+    return n;
+}
+
+/**
+ * @brief Remove a node of an indexed linked list with the value equals to the argument
+ * @details If more nodes have the value, the first one of its chain is removed (the last one added).
+ * Time complexity: O(1) expected
+ * @param l Pointer to the indexed list
+ * @param value The value of the node to be removed
+ * @return node* Pointer to the removed node.
+ * If the value is not found returns NULL
+ */
+node* indexed_remove_node_with_value(indexed_list* l, int value){
+    index_value_slot* slot = index_find_value(l, value);
+    return slot ? indexed_remove_node(l, (*slot).first) : NULL;
+}
+
+
+/**
+ * @brief Changes the value of a node in an indexed linked list
+ * @details The node moves to the chain of the new value.
+ * Time complexity: O(1) expected
+ * @param l Pointer to the indexed list
+ * @param n Pointer to the node whose value is to be changed
+ * @param new_value The new value to be assigned to the node
+ * @return node* Pointer to the changed node.
+ * If the node is not found returns NULL
+ */
+node* indexed_change_node_value(indexed_list* l, node* n, int new_value){
+    index_node_slot* slot = index_find_node(l, n);
+    if (!slot) return NULL;
+
+    node* prev = (*slot).prev;
+    index_delete(l, slot);
+    (*n).value1 = new_value;
+    index_add(l, n, prev);
+    return n;
+}
+
+/**
+ * @brief Changes the value of a node in an indexed linked list with the value equals to the argument
+ * @details If more nodes have the value, the first one of its chain is changed (the last one added).
+ * Time complexity: O(1) expected
+ * @param l Pointer to the indexed list
+ * @param value The value of the node to be changed
+ * @param new_value The new value to be assigned to the node
+ * @return node* Pointer to the changed node.
+ * If the value is not found returns NULL
+ */
+node* indexed_change_node_value_with_value(indexed_list* l, int value, int new_value){
+    index_value_slot* slot = index_find_value(l, value);
+    return slot ? indexed_change_node_value(l, (*slot).first, new_value) : NULL;
+}
+
+
+/**
+ * @brief Checks if a node is in an indexed linked list
+ * @details Time complexity: O(1) expected
+ * @param l Pointer to the indexed list
+ * @param n Pointer to the node
+ * @return node* Pointer to the node before n (n itself if it is the head).
+ * If the node is not found returns NULL
+ */
+node* indexed_node_in(indexed_list* l, node* n){
+    index_node_slot* slot = index_find_node(l, n);
+    if (!slot) return NULL;
+    return (*slot).prev ? (*slot).prev : n;
+}
+
+/**
+ * @brief Finds a node of an indexed linked list with the value equals to the argument
+ * @details If more nodes have the value, returns the first one of its chain (the last one added).
+ * Time complexity: O(1) expected
+ * @param l Pointer to the indexed list
+ * @param value The value to search
+ * @return node* Pointer to the node with the value.
+ * If the value is not found returns NULL
+ */
+node* indexed_value_in(indexed_list* l, int value){
+    index_value_slot* slot = index_find_value(l, value);
+    return slot ? (*slot).first : NULL;
+}
+
+
+/**
+ * @brief Counts the nodes of an indexed linked list with the value equals to the argument
+ * @details Read from the slot of the value.
+ * Time complexity: O(1) expected
+ * @param l Pointer to the indexed list
+ * @param value The value to count
+ * @return int The number of nodes with the value
+ */
+int indexed_count_frequents(indexed_list* l, int value){
+    index_value_slot* slot = index_find_value(l, value);
+    return slot ? (int)(*slot).count : 0;
+}
+
+
+/**
+ * @brief Memory used by the hash tables of an indexed linked list
+ * @details The nodes are not counted (sizeof(node) bytes each, plus the allocator overhead).
+ * Time complexity: O(1)
+ * @param l Pointer to the indexed list
+ * @return size_t Bytes of the tables
+ */
+size_t indexed_memory(indexed_list* l){
+    if (!l) return 0;
+    return (size_t)(*l).nodes.capacity * sizeof(index_node_slot) + (size_t)(*l).values.capacity * sizeof(index_value_slot);
+}
+
+
+
+// :::::::::::::::::::::::::::::::::::::::::::::::::: BENCHMARKS :::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+/**
+ * @brief Compares the operations by value of the indexed list with the linked_list ones
+ * @details Values 0, ..., n-1 in random order. Prints ns/operation of search, count,
+ * change (and back) and remove (and insert at the end) of random values,
+ * with the indexed list (ops operations) and with the linked_list (ops / 1000, they walk the list),
+ * and the memory of the tables for each node. Then, with n equal values, ns/node of the creation
+ * and ns/operation of moving the tail to the head (ops operations).
+ * Time complexity: O(ops * (1 + n / 1000))
+ * @param n Number of nodes of the lists
+ * @param ops Number of operations of each kind on the indexed list
+ * @return void Doesn't return a value
+ */
+void benchmark_indexed(unsigned int n, unsigned int ops){
+    if (n == 0) return;
+    int* values = benchmark_values(n);
+    srand(12345);
+    for (unsigned int i = n - 1; i > 0; i--){ // Fisher-Yates shuffle
+        unsigned int j = (unsigned int)(((unsigned long long)rand() * RAND_MAX + rand()) % (i + 1));
+        int temp = values[i];
+        values[i] = values[j];
+        values[j] = temp;
+    }
+    indexed_list indexed = indexed_create_list(values, n);
+    linked_list plain = linked_list_create(values, n);
+    long long sink = 0;
+
+    const char* names[] = {"search", "count", "change", "remove"};
+    for (int kind = 0; kind < 4; kind++){
+        double times[2];
+        for (int k = 0; k < 2; k++){
+            unsigned int m = k ? ops / 1000 + 1 : ops;
+            clock_t start = clock();
+            for (unsigned int i = 0; i < m; i++){
+                int v = (int)(((unsigned long long)i * 2654435761u) % n);
+                if (kind == 0) sink += k ? linked_list_value_in(&plain, v) != NULL : indexed_value_in(&indexed, v) != NULL;
+                else if (kind == 1) sink += k ? linked_list_count_frequents(&plain, v) : indexed_count_frequents(&indexed, v);
+                else if (kind == 2){
+                    if (k){
+                        linked_list_change_node_value_with_value(&plain, v, -1);
+                        linked_list_change_node_value_with_value(&plain, -1, v);
+                    } else {
+                        indexed_change_node_value_with_value(&indexed, v, -1);
+                        indexed_change_node_value_with_value(&indexed, -1, v);
+                    }
+                } else {
+                    if (k) linked_list_insertion_end_node(&plain, linked_list_remove_node_with_value(&plain, v));
+                    else indexed_insertion_end_node(&indexed, indexed_remove_node_with_value(&indexed, v));
+                }
+            }
+            times[k] = ns_per_element(start, m);
+        }
+        printf("%s: indexed %.2f ns/op, linked_list %.2f ns/op\n", names[kind], times[0], times[1]);
+    }
+
+    printf("tables: %u node slots and %u value slots for %u nodes, %zu bytes (%.1f bytes/node, node %zu bytes) (checksum %lld)\n",
+           indexed.nodes.capacity, indexed.values.capacity, indexed.nodes.used, indexed_memory(&indexed),
+           (double)indexed_memory(&indexed) / indexed.nodes.used, sizeof(node), sink);
+    indexed_clear_list(&indexed);
+
+    for (unsigned int i = 0; i < n; i++) values[i] = 0; // every node with the same value
+    clock_t start = clock();
+    indexed_list same = indexed_create_list(values, n);
+    double create = ns_per_element(start, n);
+    start = clock();
+    for (unsigned int i = 0; i < ops; i++) indexed_insertion_head_node(&same, indexed_remove_node(&same, same.list.tail));
+    double move = ns_per_element(start, ops);
+    printf("%u equal values: create %.2f ns/node, remove the tail and insert it at the head %.2f ns/op\n", n, create, move);
+    indexed_clear_list(&same);
+    linked_list_clear(&plain);
+    free(values);
+}
+
+
+
+// :::::::::::::::::::::::::::::::::::::::::::::::::::::: TESTS ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+/**
+ * @brief Checks an indexed linked list and its tables against the expected values, used by the tests
+ * @details Walks the list: the values must be the expected ones in order, the length and the tail must match,
+ * and every node must be in the table of the nodes with the node before it.
+ * Then, for each expected value, the slot of the value must count its nodes, and its chain must link exactly
+ * that many nodes with the value, each one pointing back to the one before it in the chain.
+ * The tables must have no other slots.
+ * Time complexity: O(n^2), n = number of nodes in the list
+ * @param l Pointer to the indexed list
+ * @param values Array of the expected values
+ * @param length Number of expected values
+ * @return int 1 if the list and the tables have the values, 0 otherwise
+ */
+int test_indexed_matches(indexed_list* l, int values[], unsigned int length){
+    if ((*l).list.length != length || !(*l).list.head != !(*l).list.tail) return 0;
+    unsigned int i = 0;
+    node* prev = NULL;
+    for (node* temp = (*l).list.head; temp; prev = temp, temp = (*temp).next, i++){
+        index_node_slot* slot = index_find_node(l, temp);
+        if (i >= length || (*temp).value1 != values[i] || !slot || (*slot).prev != prev) return 0;
+    }
+    if (i != length || (*l).list.tail != prev || (*l).nodes.used != length) return 0;
+
+    unsigned int distinct = 0;
+    for (i = 0; i < length; i++){
+        unsigned int count = 0, first = 1;
+        for (unsigned int j = 0; j < length; j++){
+            if (values[j] != values[i]) continue;
+            count++;
+            if (j < i) first = 0;
+        }
+        if (!first) continue; // the value is already checked
+        distinct++;
+
+        index_value_slot* value = index_find_value(l, values[i]);
+        if (!value || (*value).count != count || indexed_count_frequents(l, values[i]) != (int)count) return 0;
+        unsigned int chain = 0;
+        node* same_prev = NULL;
+        for (node* temp = (*value).first; temp; temp = (*index_find_node(l, temp)).same_next){
+            index_node_slot* slot = index_find_node(l, temp);
+            if (!slot || (*temp).value1 != values[i] || (*slot).same_prev != same_prev || ++chain > count) return 0;
+            same_prev = temp;
+        }
+        if (chain != count) return 0;
+    }
+    return (*l).values.used == distinct;
+}
+
+/**
+ * @brief Tests the insertions, the removes and the changes of an indexed linked list
+ * @details The values repeat, so the chains have more nodes. Inserts at the head, at the end,
+ * after and before a middle node, removes the head, the tail, a node and values (also not in the list),
+ * changes values (also to a value not in the list and back), checking the list and the tables after each operation.
+ * Time complexity: O(1)
+ * @return int 1 if the test passes, 0 otherwise
+ */
+int test_indexed_insert_remove(){
+    int start[4] = {2, 1, 2, 1};
+    indexed_list l = indexed_create_list(start, 4);
+    int passed = test_indexed_matches(&l, start, 4);
+
+    indexed_insertion_head_node(&l, create_node(2));
+    int step1[5] = {2, 2, 1, 2, 1};
+    passed = passed && test_indexed_matches(&l, step1, 5);
+    indexed_insertion_end_node(&l, create_node(3));
+    int step2[6] = {2, 2, 1, 2, 1, 3};
+    passed = passed && test_indexed_matches(&l, step2, 6);
+    node* middle = (*(*l.list.head).next).next; // the first 1
+    passed = passed && indexed_insertion_after_node(&l, middle, create_node(1));
+    passed = passed && indexed_insertion_before_node(&l, middle, create_node(2));
+    int step3[8] = {2, 2, 2, 1, 1, 2, 1, 3};
+    passed = passed && test_indexed_matches(&l, step3, 8);
+    passed = passed && indexed_insertion_before_node(&l, l.list.head, create_node(3));
+    passed = passed && indexed_insertion_after_node(&l, l.list.tail, create_node(1));
+    int step4[10] = {3, 2, 2, 2, 1, 1, 2, 1, 3, 1};
+    passed = passed && test_indexed_matches(&l, step4, 10);
+    passed = passed && indexed_node_in(&l, middle) == (*(*(*l.list.head).next).next).next && indexed_node_in(&l, l.list.head) == l.list.head;
+
+    free(indexed_remove_node(&l, l.list.head));
+    int step5[9] = {2, 2, 2, 1, 1, 2, 1, 3, 1};
+    passed = passed && test_indexed_matches(&l, step5, 9);
+    free(indexed_remove_node(&l, l.list.tail));
+    int step6[8] = {2, 2, 2, 1, 1, 2, 1, 3};
+    passed = passed && test_indexed_matches(&l, step6, 8);
+    passed = passed && indexed_remove_node(&l, middle) == middle && !(*middle).next && !indexed_node_in(&l, middle);
+    int step7[7] = {2, 2, 2, 1, 2, 1, 3};
+    passed = passed && test_indexed_matches(&l, step7, 7);
+    passed = passed && !indexed_remove_node(&l, middle) && !indexed_remove_node_with_value(&l, 42);
+    free(middle);
+    passed = passed && test_indexed_matches(&l, step7, 7);
+    free(indexed_remove_node_with_value(&l, 3));
+    int step8[6] = {2, 2, 2, 1, 2, 1};
+    passed = passed && test_indexed_matches(&l, step8, 6) && !indexed_value_in(&l, 3);
+    node* first = indexed_value_in(&l, 2); // the 2 inserted before the removed middle node, the last one added
+    passed = passed && indexed_remove_node_with_value(&l, 2) == first;
+    free(first);
+    int step9[5] = {2, 2, 1, 2, 1};
+    passed = passed && test_indexed_matches(&l, step9, 5);
+
+    passed = passed && indexed_change_node_value(&l, l.list.head, 5) == l.list.head;
+    int step10[5] = {5, 2, 1, 2, 1};
+    passed = passed && test_indexed_matches(&l, step10, 5);
+    first = indexed_value_in(&l, 1); // the 1 inserted after the removed middle node
+    passed = passed && indexed_change_node_value_with_value(&l, 1, 2) == first;
+    int step11[5] = {5, 2, 2, 2, 1};
+    passed = passed && test_indexed_matches(&l, step11, 5) && indexed_value_in(&l, 2) == first;
+    passed = passed && indexed_change_node_value(&l, first, 2) == first && test_indexed_matches(&l, step11, 5);
+    passed = passed && !indexed_change_node_value_with_value(&l, 42, 1) && !indexed_change_node_value(&l, NULL, 1);
+    passed = passed && indexed_change_node_value_with_value(&l, 5, 1) == l.list.head;
+    int step12[5] = {1, 2, 2, 2, 1};
+    passed = passed && test_indexed_matches(&l, step12, 5);
+
+    while (l.list.head) free(indexed_remove_node_with_value(&l, indexed_value_in(&l, 2) ? 2 : 1));
+    passed = passed && test_indexed_matches(&l, NULL, 0) && !indexed_remove_node(&l, l.list.head);
+    indexed_insertion_end_node(&l, create_node(8)); // into the empty list
+    int single[1] = {8};
+    passed = passed && test_indexed_matches(&l, single, 1);
+    printf("insertions, removes and changes: %s\n", passed ? "passed" : "FAILED");
+    indexed_clear_list(&l);
+    return passed;
+}
+
+/**
+ * @brief Tests the splits and the concatenations of an indexed linked list
+ * @details With repeated values, splits at two values and concatenates the three parts back,
+ * then splits at every node and concatenates back: the nodes of the shorter part move to the tables of the longer one,
+ * the second part when splitting near the tail, the first one near the head.
+ * Then splits at a value and at a node not in the list, and at the tail.
+ * The list and the tables of both parts are checked after each operation.
+ * Time complexity: O(1)
+ * @return int 1 if the test passes, 0 otherwise
+ */
+int test_indexed_split_concatenate(){
+    int values[10] = {3, 1, 4, 1, 5, 9, 2, 6, 5, 3};
+    indexed_list l = indexed_create_list(values, 10);
+    int passed = test_indexed_matches(&l, values, 10);
+
+    indexed_list second = indexed_split_at_value(&l, 5); // the last 5, the last one added
+    passed = passed && test_indexed_matches(&l, values, 9) && test_indexed_matches(&second, values + 9, 1);
+    indexed_list third = indexed_split_at_value(&l, 1); // the second 1
+    passed = passed && test_indexed_matches(&l, values, 4) && test_indexed_matches(&third, values + 4, 5);
+    indexed_concatenate(&third, &second);
+    indexed_concatenate(&l, &third);
+    passed = passed && test_indexed_matches(&l, values, 10) && test_indexed_matches(&third, NULL, 0);
+
+    node* n = l.list.head;
+    for (unsigned int i = 0; i < 9; i++, n = (*n).next){
+        second = indexed_split_at_node(&l, n);
+        passed = passed && test_indexed_matches(&l, values, i + 1) && test_indexed_matches(&second, values + i + 1, 9 - i);
+        indexed_concatenate(&l, &second);
+        passed = passed && test_indexed_matches(&l, values, 10) && test_indexed_matches(&second, NULL, 0);
+    }
+
+    node outside = {7, NULL};
+    second = indexed_split_at_value(&l, 42);
+    passed = passed && test_indexed_matches(&second, NULL, 0);
+    second = indexed_split_at_node(&l, &outside);
+    passed = passed && test_indexed_matches(&second, NULL, 0);
+    second = indexed_split_at_node(&l, l.list.tail);
+    passed = passed && test_indexed_matches(&second, NULL, 0) && test_indexed_matches(&l, values, 10);
+    printf("splits and concatenations: %s\n", passed ? "passed" : "FAILED");
+    indexed_clear_list(&l);
+    return passed;
+}
+
+/**
+ * @brief Entry point of the program, used for testing
+ * @details Runs the tests, then the indexed list benchmark
+ * (the optional arguments are the number of nodes, default 1000000, and of operations, default 1000000).
+ * @return 0 on successful execution
+ */
+int main(int argc, char* argv[]){
+    int passed = test_indexed_insert_remove();
+    passed = test_indexed_split_concatenate() && passed;
+
+    unsigned int n = argc > 1 ? (unsigned int)strtoul(argv[1], NULL, 10) : 1000000;
+    unsigned int ops = argc > 2 ? (unsigned int)strtoul(argv[2], NULL, 10) : 1000000;
+    benchmark_indexed(n, ops);
+    return passed ? 0 : 1;
+
+    /* compiling: gcc indexedList.c -o indexedList -lpthread
+    executing: indexedList [nodes [operations]] */
+}
@@ -6,6 +6,199 @@
  */
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h> // sort_list_parallel
+#if defined(__AVX2__)
+#include <immintrin.h> // SIMD aggregates on arrays
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::: INSTRUMENT ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+/* Optional counters of the functions of the LIST section, compiled with -DLINKEDLIST_INSTRUMENT (GCC or Clang):
+   node allocations and frees, calls, nodes visited and a latency histogram for each function.
+   Without it the hooks are empty macros, the counters are not defined and the functions are unchanged.
+   LIST OF FUNCTIONS:
+    1) instrument_snapshot
+    2) instrument_reset
+    3) instrument_dump
+    with LINKEDLIST_INSTRUMENT:
+        4) instrument_now_ns
+        5) instrument_end */
+
+
+#define INSTRUMENT_BUCKETS 32 // bucket i: calls that took [2^i, 2^(i+1)) ns
+
+enum{ // functions of the LIST section with their counters
+    INSTRUMENT_CREATE_NODE, INSTRUMENT_CREATE_LIST, INSTRUMENT_PRINT_LIST, INSTRUMENT_CLEAR_LIST,
+    INSTRUMENT_INSERTION_HEAD_NODE, INSTRUMENT_INSERTION_END_NODE, INSTRUMENT_INSERTION_AFTER_NODE,
+    INSTRUMENT_INSERTION_BEFORE_NODE, INSTRUMENT_CONCATENATE_LISTS, INSTRUMENT_SPLIT_LIST_AT_NODE,
+    INSTRUMENT_SPLIT_LIST_AT_VALUE, INSTRUMENT_REMOVE_NODE, INSTRUMENT_REMOVE_NODE_WITH_VALUE,
+    INSTRUMENT_CHANGE_NODE_VALUE, INSTRUMENT_CHANGE_NODE_VALUE_WITH_VALUE, INSTRUMENT_NODE_IN_LIST,
+    INSTRUMENT_VALUE_IN_LIST, INSTRUMENT_REVERSE_LIST, INSTRUMENT_LIST_LENGTH, INSTRUMENT_MAX_LIST,
+    INSTRUMENT_MIN_LIST, INSTRUMENT_COUNT_FREQUENTS_IN_LIST, INSTRUMENT_MERGE_RUNS, INSTRUMENT_SORT_LIST,
+    INSTRUMENT_LIST_VALUES, INSTRUMENT_OPERATIONS
+};
+
+/**
+ * @struct instrument_counters
+ * @brief Represent the counters of the instrumented functions
+ * @details Nodes allocated and freed by the library (with malloc or in arenas), and for each function the calls,
+ * the nodes visited (total and most in one call) and the histogram of the time of the calls.
+ * Time complexity: O(1)
+ */
+typedef struct{
+    unsigned long long allocations;
+    unsigned long long frees;
+    unsigned long long calls[INSTRUMENT_OPERATIONS];
+    unsigned long long visited[INSTRUMENT_OPERATIONS];
+    unsigned long long max_visited[INSTRUMENT_OPERATIONS];
+    unsigned long long latency[INSTRUMENT_OPERATIONS][INSTRUMENT_BUCKETS];
+} instrument_counters;
+
+#if defined(LINKEDLIST_INSTRUMENT)
+#if !defined(__GNUC__)
+#error "LINKEDLIST_INSTRUMENT needs the cleanup attribute and the atomic builtins of GCC or Clang"
+#endif
+
+const char* INSTRUMENT_NAMES[INSTRUMENT_OPERATIONS] = {
+    "create_node", "create_list", "print_list", "clear_list",
+    "insertion_head_node", "insertion_end_node", "insertion_after_node",
+    "insertion_before_node", "concatenate_lists", "split_list_at_node",
+    "split_list_at_value", "remove_node", "remove_node_with_value",
+    "change_node_value", "change_node_value_with_value", "node_in_list",
+    "value_in_list", "reverse_list", "list_length", "max_list",
+    "min_list", "count_frequents_in_list", "merge_runs", "sort_list",
+    "list_values"
+};
+
+instrument_counters instrument_totals; // updated with relaxed atomics, the functions can run in threads
+
+/**
+ * @struct instrument_call
+ * @brief Represent a running call of an instrumented function
+ * @details It has the function, the nodes visited so far and the start time.
+ * Time complexity: O(1)
+ */
+typedef struct{
+    int operation;
+    unsigned long long visited;
+    long long start;
+} instrument_call;
+
+/**
+ * @brief Monotonic time in nanoseconds
+ * @details Uses CLOCK_MONOTONIC, which doesn't jump when the system time is changed;
+ * where it is not available falls back to the wall clock of timespec_get.
+ * Time complexity: O(1)
+ * @return long long Nanoseconds from an unspecified start
+ */
+long long instrument_now_ns(){
+    struct timespec now;
+#if defined(CLOCK_MONOTONIC)
+    clock_gettime(CLOCK_MONOTONIC, &now);
+#else
+    timespec_get(&now, TIME_UTC);
+#endif
+    return (long long)now.tv_sec * 1000000000LL + now.tv_nsec;
+}
+
+/**
+ * @brief Adds a finished call to the counters
+ * @details Called by the cleanup attribute when the scope of INSTRUMENT_CALL ends (at every return).
+ * Time complexity: O(1)
+ * @param call Pointer to the call
+ * @return void Doesn't return a value
+ */
+void instrument_end(instrument_call* call){
+    long long ns = instrument_now_ns() - (*call).start;
+    int bucket = 0;
+    while (bucket < INSTRUMENT_BUCKETS - 1 && (ns >> (bucket + 1)) > 0) bucket++;
+
+    int op = (*call).operation;
+    __atomic_fetch_add(&instrument_totals.calls[op], 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&instrument_totals.visited[op], (*call).visited, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&instrument_totals.latency[op][bucket], 1, __ATOMIC_RELAXED);
+    unsigned long long max = __atomic_load_n(&instrument_totals.max_visited[op], __ATOMIC_RELAXED);
+    while ((*call).visited > max && !__atomic_compare_exchange_n(&instrument_totals.max_visited[op], &max,
+                                                                  (*call).visited, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+}
+
+#define INSTRUMENT_CALL(op) \
+    instrument_call instrument_scope __attribute__((cleanup(instrument_end))) = {(op), 0, instrument_now_ns()}
+#define INSTRUMENT_VISIT() (instrument_scope.visited++)
+#define INSTRUMENT_ALLOCATIONS(count) __atomic_fetch_add(&instrument_totals.allocations, (count), __ATOMIC_RELAXED)
+#define INSTRUMENT_FREES(count) __atomic_fetch_add(&instrument_totals.frees, (count), __ATOMIC_RELAXED)
+#else
+#define INSTRUMENT_CALL(op) ((void)0)
+#define INSTRUMENT_VISIT() ((void)0)
+#define INSTRUMENT_ALLOCATIONS(count) ((void)0)
+#define INSTRUMENT_FREES(count) ((void)0)
+#endif
+
+
+/**
+ * @brief Copy of the counters
+ * @details All zero without LINKEDLIST_INSTRUMENT.
+ * Time complexity: O(1)
+ * @return instrument_counters The counters now
+ */
+instrument_counters instrument_snapshot(){
+    instrument_counters snapshot;
+#if defined(LINKEDLIST_INSTRUMENT)
+    unsigned long long* from = (unsigned long long*)&instrument_totals; // every field is an unsigned long long
+    unsigned long long* to = (unsigned long long*)&snapshot;
+    for (size_t i = 0; i < sizeof(snapshot) / sizeof(unsigned long long); i++)
+        to[i] = __atomic_load_n(&from[i], __ATOMIC_RELAXED); // each counter is consistent, not the whole copy
+#else
+    memset(&snapshot, 0, sizeof(snapshot));
+#endif
+    return snapshot;
+}
+
+/**
+ * @brief Sets every counter to 0
+ * @details To be called when no instrumented function is running. Does nothing without LINKEDLIST_INSTRUMENT.
+ * Time complexity: O(1)
+ * @return void Doesn't return a value
+ */
+void instrument_reset(){
+#if defined(LINKEDLIST_INSTRUMENT)
+    memset(&instrument_totals, 0, sizeof(instrument_totals));
+#endif
+}
+
+
+/**
+ * @brief Prints counters
+ * @details The allocations and frees, then for each called function the calls, the average and max nodes visited,
+ * and the non empty buckets of the latency histogram as "<2^(i+1)ns:count".
+ * Time complexity: O(INSTRUMENT_OPERATIONS * INSTRUMENT_BUCKETS)
+ * @param f File to print to (stdout, stderr or an open file)
+ * @param counters Pointer to the counters (from instrument_snapshot)
+ * @return void Doesn't return a value
+ */
+void instrument_dump(FILE* f, const instrument_counters* counters){
+    if (!f || !counters) return;
+#if defined(LINKEDLIST_INSTRUMENT)
+    fprintf(f, "allocations %llu, frees %llu\n", (*counters).allocations, (*counters).frees);
+    for (int op = 0; op < INSTRUMENT_OPERATIONS; op++){
+        unsigned long long calls = (*counters).calls[op];
+        if (!calls) continue;
+        fprintf(f, "%s: calls %llu, visited %.1f/call (max %llu), latency", INSTRUMENT_NAMES[op], calls,
+                (double)(*counters).visited[op] / calls, (*counters).max_visited[op]);
+        for (int b = 0; b < INSTRUMENT_BUCKETS; b++)
+            if ((*counters).latency[op][b]) fprintf(f, " <%lluns:%llu", 2ULL << b, (*counters).latency[op][b]);
+        fprintf(f, "\n");
+    }
+#else
+    fprintf(f, "instrumentation disabled (compile with -DLINKEDLIST_INSTRUMENT)\n");
+#endif
+}
+
 
 
 
@@ -40,8 +233,96 @@
     22) max_list
     23) min_list
     24) count_frequents_in_list
-    25) sort_list 
-    26) list_values */
+    25) sort_list (bottom-up merge sort, with merge_runs)
+    26) list_values
+
+ARENA (nodes allocated in slabs):
+    27) create_arena
+    28) arena_create_node
+    29) arena_free_node
+    30) arena_create_list (with arena_reserve_nodes)
+    31) arena_clear_list
+    32) clear_arena
+
+LINKED_LIST (head, tail and length):
+    creations:
+        33) linked_list_create
+    34) linked_list_print
+    35) linked_list_clear
+    insertions:
+        36) linked_list_insertion_head_node
+        37) linked_list_insertion_end_node
+        38) linked_list_insertion_after_node
+        39) linked_list_insertion_before_node
+    40) linked_list_concatenate
+    41) linked_list_split_at_node
+    42) linked_list_split_at_value
+    removes:
+        43) linked_list_remove_node
+        44) linked_list_remove_node_with_value
+    changes:
+        45) linked_list_change_node_value
+        46) linked_list_change_node_value_with_value
+    47) linked_list_is_empty
+    in_list:
+        48) linked_list_node_in
+        49) linked_list_value_in
+    50) linked_list_reverse
+    51) linked_list_length
+    52) linked_list_max
+    53) linked_list_min
+    54) linked_list_count_frequents
+    55) linked_list_sort
+    56) linked_list_values
+
+AGGREGATES (min, max, length and frequency in one pass):
+    57) aggregate_list
+    58) aggregate_values
+
+PARALLEL_SORT (segments sorted by threads, then a merge tree):
+    59) sort_list_parallel (with sort_segment_worker, merge_segments_worker and run_tasks)
+
+RADIX_SORT (nodes relinked in chains by digit, no comparisons):
+    60) radix_sort_list (with radix_append)
+    61) sort_list_adaptive (radix_sort_list or sort_list by length)
+
+CURSOR (position in a linked_list for operations without searching from the head):
+    62) cursor_begin
+    63) cursor_next
+    64) cursor_at_end
+    insertions:
+        65) cursor_insertion_before
+        66) cursor_insertion_after
+    67) cursor_remove
+    68) cursor_split
+
+BULK (one walk for many nodes, optional arena for the nodes):
+    removes:
+        69) linked_list_remove_if
+        70) linked_list_remove_all_with_value (with value_equals)
+    71) linked_list_filter
+    72) linked_list_map
+    73) linked_list_splice_values
+
+COMPACTION (nodes copied in traversal order into one block):
+    74) list_fragmentation
+    75) compact_list (with compact_nodes)
+    76) linked_list_compact (when the fragmentation reaches a threshold)
+
+MAP_REDUCE (k segments run by threads, then stitched back):
+    77) linked_list_split_k
+    78) linked_list_stitch
+    79) segments_map_reduce (with map_segment_worker)
+    80) linked_list_map_reduce (split, segments_map_reduce and stitch)
+
+SET_OPERATIONS (sorted lists, one walk relinking the nodes):
+    81) linked_list_dedupe
+    82) linked_list_merge
+    83) linked_list_union
+    84) linked_list_intersection
+    85) linked_list_difference
+
+INSTRUMENT (before the LIST section): instrument_snapshot, instrument_reset, instrument_dump */
 
 
 /**
@@ -78,12 +359,14 @@ typedef struct{
  * @return node* Pointer to the new node
  */
 node* create_node(int v1){
+    INSTRUMENT_CALL(INSTRUMENT_CREATE_NODE);
     node* new_node = (node*)malloc(sizeof(node)); // dynamic allocation for the new node
     if (!new_node) {
         printf("Memory allocation failed\n");
         exit(EXIT_FAILURE); // critical error
     }
 
+    INSTRUMENT_ALLOCATIONS(1);
     (*new_node).value1 = v1; // (*...) dereference
     (*new_node).next = NULL;
     return new_node;
@@ -114,11 +397,14 @@ node* create_empty_node(){
  * If the argument is NULL or the length is zero returns NULL
  */
 node* create_list(int values[], unsigned int length) {
+    INSTRUMENT_CALL(INSTRUMENT_CREATE_LIST);
     if (length == 0 || values == NULL) return NULL;
 
     node* head = create_node(values[0]);
+    INSTRUMENT_VISIT();
     node* temp = head;
     for (unsigned int i = 1; i < length; i++){
+        INSTRUMENT_VISIT();
         node* n = create_node(values[i]);
         (*temp).next = n;
         temp = n;
@@ -134,11 +420,13 @@ node* create_list(int values[], unsigned int length) {
  * @return void Doesn't return a value
  */
 void print_list(node* head){
+    INSTRUMENT_CALL(INSTRUMENT_PRINT_LIST);
     if (!head) return;
 
     node* temp = head;
     printf("[");
     while((*temp).next) {
+        INSTRUMENT_VISIT();
         printf("%d, ", (*temp).value1);
         temp = (*temp).next;
     }
@@ -154,13 +442,16 @@ void print_list(node* head){
  * @return void Doesn't return a value
  */
 void clear_list(node* head){
+    INSTRUMENT_CALL(INSTRUMENT_CLEAR_LIST);
     if (!head) return;
 
     node* temp;
     while(head) {
+        INSTRUMENT_VISIT();
         temp = head;
         head = (*head).next;
         free(temp); // deallocate memory
+        INSTRUMENT_FREES(1);
     }
 
     // alternative:
@@ -177,6 +468,7 @@ void clear_list(node* head){
  * @return node* Pointer to the new head of the linked list
  */
 node* insertion_head_node(node* head, node* n){
+    INSTRUMENT_CALL(INSTRUMENT_INSERTION_HEAD_NODE);
     if (!head && !n) return NULL;
     if (!head) return n;
     if (!n) return head;
@@ -194,12 +486,16 @@ node* insertion_head_node(node* head, node* n){
  * @return node* Pointer to the head of the modified linked list
  */
 node* insertion_end_node(node* head, node* n){
+    INSTRUMENT_CALL(INSTRUMENT_INSERTION_END_NODE);
     if (!head && !n) return NULL;
     if (!head) return n;
     if (!n) return head;
 
     node* temp = head;
-    while((*temp).next) temp = (*temp).next;
+    while((*temp).next){
+        INSTRUMENT_VISIT();
+        temp = (*temp).next;
+    }
     (*temp).next = n;
     return head;
 }
@@ -214,12 +510,16 @@ node* insertion_end_node(node* head, node* n){
  * @return node* Pointer to the head of the modified linked list
  */
 node* insertion_after_node(node* head, node* n, node* after_n){
+    INSTRUMENT_CALL(INSTRUMENT_INSERTION_AFTER_NODE);
     if (!head && !after_n) return NULL;
     if (!head) return after_n;
     if (!after_n || !n) return head;
 
     node* temp = head;
-    while(temp && temp != n) temp = (*temp).next;
+    while(temp && temp != n){
+        INSTRUMENT_VISIT();
+        temp = (*temp).next;
+    }
     if (!temp) return head;
 
     (*after_n).next = (*temp).next;
@@ -237,12 +537,16 @@ node* insertion_after_node(node* head, node* n, node* after_n){
  * @return node* Pointer to the head of the modified linked list
  */
 node* insertion_before_node(node* head, node* n, node* before_n){
+    INSTRUMENT_CALL(INSTRUMENT_INSERTION_BEFORE_NODE);
     if (!head && !before_n) return NULL;
     if (!head) return before_n;
     if (!before_n || !n) return head;
 
     node* temp = head;
-    while((*temp).next && (*temp).next != n) temp = (*temp).next;
+    while((*temp).next && (*temp).next != n){
+        INSTRUMENT_VISIT();
+        temp = (*temp).next;
+    }
     if (!(*temp).next) return head;
 
     (*before_n).next = (*temp).next;
@@ -261,6 +565,7 @@ node* insertion_before_node(node* head, node* n, node* before_n){
  * If both lists are empty, returns NULL
  */
 node* concatenate_lists(node* head1, node* head2){
+    INSTRUMENT_CALL(INSTRUMENT_CONCATENATE_LISTS);
     if(!head1 && !head2) return NULL;
     if(!head1) return head2;
     if(!head2) return head1;
@@ -280,6 +585,7 @@ node* concatenate_lists(node* head1, node* head2){
  * If the specified node is not found, the second part will be NULL.
  */
 tuple split_list_at_node(node* head, node* n){
+    INSTRUMENT_CALL(INSTRUMENT_SPLIT_LIST_AT_NODE);
     tuple result = {head, NULL};
 
     if (!head) return result;
@@ -291,7 +597,10 @@ tuple split_list_at_node(node* head, node* n){
     }
 
     node* temp = head;
-    while(temp && temp != n) temp = (*temp).next;
+    while(temp && temp != n){
+        INSTRUMENT_VISIT();
+        temp = (*temp).next;
+    }
     if (!temp) return result; // n not found
 
     result.node2 = (*temp).next;
@@ -310,6 +619,7 @@ tuple split_list_at_node(node* head, node* n){
  * If the specified value is not found, the second part will be NULL.
  */
 tuple split_list_at_value(node* head, int value){
+    INSTRUMENT_CALL(INSTRUMENT_SPLIT_LIST_AT_VALUE);
     tuple result = {head, NULL};
 
     if (!head) return result;
@@ -321,7 +631,10 @@ tuple split_list_at_value(node* head, int value){
     }
 
     node* temp = head;
-    while(temp && (*temp).value1 != value) temp = (*temp).next;
+    while(temp && (*temp).value1 != value){
+        INSTRUMENT_VISIT();
+        temp = (*temp).next;
+    }
     if (!temp) return result; // n not found
 
     result.node2 = (*temp).next;
@@ -339,6 +652,7 @@ tuple split_list_at_value(node* head, int value){
  * and the pointer to the removed node
  */
 tuple remove_node(node* head, node* n){
+    INSTRUMENT_CALL(INSTRUMENT_REMOVE_NODE);
     tuple result = {head, NULL};
     
     if (!head || !n) return result;
@@ -351,7 +665,10 @@ tuple remove_node(node* head, node* n){
     }
 
     node* temp = head;
-    while((*temp).next && (*temp).next != n) temp = (*temp).next;
+    while((*temp).next && (*temp).next != n){
+        INSTRUMENT_VISIT();
+        temp = (*temp).next;
+    }
     if (!(*temp).next) return result; // n not found
 
     (*temp).next = (*n).next;
@@ -369,6 +686,7 @@ tuple remove_node(node* head, node* n){
  * and the pointer to the removed node
  */
 tuple remove_node_with_value(node* head, int value){
+    INSTRUMENT_CALL(INSTRUMENT_REMOVE_NODE_WITH_VALUE);
     tuple result = {head, NULL};
     
     if (!head) return result;
@@ -381,7 +699,10 @@ tuple remove_node_with_value(node* head, int value){
     }
 
     node* temp = head;
-    while((*temp).next && (*(*temp).next).value1 != value) temp = (*temp).next;
+    while((*temp).next && (*(*temp).next).value1 != value){
+        INSTRUMENT_VISIT();
+        temp = (*temp).next;
+    }
     if (!(*temp).next) return result; // n not found
 
     result.node2 = (*temp).next;
@@ -401,11 +722,13 @@ tuple remove_node_with_value(node* head, int value){
  * If the list is empty, returns NULL
  */
 node* change_node_value(node* head, node* n, int new_value){
+    INSTRUMENT_CALL(INSTRUMENT_CHANGE_NODE_VALUE);
     if (!head) return NULL;
     if (!n) return head;
 
     node* temp = head;
     while(temp){
+        INSTRUMENT_VISIT();
         if (temp == n){
             (*temp).value1 = new_value;
             return head;
@@ -425,10 +748,12 @@ node* change_node_value(node* head, node* n, int new_value){
  * If the list is empty, returns NULL
  */
 node* change_node_value_with_value(node* head, int value, int new_value){
+    INSTRUMENT_CALL(INSTRUMENT_CHANGE_NODE_VALUE_WITH_VALUE);
     if (!head) return NULL;
 
     node* temp = head;
     while(temp){
+        INSTRUMENT_VISIT();
         if ((*temp).value1 == value){
             (*temp).value1 = new_value;
             return head;
@@ -460,14 +785,15 @@ int is_empty_list(node* head){
  * If the node is not found, the second element of the tuple is NULL.
  */
 tuple node_in_list(node* head, node* n){
+    INSTRUMENT_CALL(INSTRUMENT_NODE_IN_LIST);
     tuple result = {head, NULL};
 
     if(!head || !n) return result;
 
     node* temp = head;
     while(temp){
+        INSTRUMENT_VISIT();
         if (temp == n){
-            (*n).next = NULL;
             result.node2 = n;
             return result;
         }
@@ -485,12 +811,14 @@ tuple node_in_list(node* head, node* n){
  * If the value is not found, the second element of the tuple is NULL
  */
 tuple value_in_list(node* head, int value){
+    INSTRUMENT_CALL(INSTRUMENT_VALUE_IN_LIST);
     tuple result = {head, NULL};
 
     if(!head) return result;
 
     node* temp = head;
     while(temp){
+        INSTRUMENT_VISIT();
         if ((*temp).value1 == value){
             result.node2 = temp;
             return result;
@@ -509,12 +837,14 @@ tuple value_in_list(node* head, int value){
  * If the list is empty returns NULL
  */
 node* reverse_list(node* head){
+    INSTRUMENT_CALL(INSTRUMENT_REVERSE_LIST);
     if (!head) return NULL;
 
     node* prev = NULL;
     node* current = head;
     node* next = NULL;
     while(current){
+        INSTRUMENT_VISIT();
         next = (*current).next;
         (*current).next = prev;
         prev = current;
@@ -531,9 +861,11 @@ node* reverse_list(node* head){
  * @return int The length of the linked list
  */
 int list_length(node* head){
+    INSTRUMENT_CALL(INSTRUMENT_LIST_LENGTH);
     int length = 0;
     node* temp = head;
     while(temp){
+        INSTRUMENT_VISIT();
         temp = (*temp).next;
         length ++;
     }
@@ -549,11 +881,13 @@ int list_length(node* head){
  * If the list is empty return the default value of a node
  */
 int max_list(node* head){
+    INSTRUMENT_CALL(INSTRUMENT_MAX_LIST);
     if (!head) return DEFAULT_VALUE;
 
     node* temp = head;
     int max = (*head).value1;
     while(temp){
+        INSTRUMENT_VISIT();
         if((*temp).value1 > max) max = (*temp).value1;
         temp = (*temp).next;
     }
@@ -568,11 +902,13 @@ int max_list(node* head){
  * If the list is empty return the default value of a node
  */
 int min_list(node* head){
+    INSTRUMENT_CALL(INSTRUMENT_MIN_LIST);
     if (!head) return DEFAULT_VALUE;
 
     node* temp = head;
     int min = (*head).value1;
     while(temp){
+        INSTRUMENT_VISIT();
         if((*temp).value1 < min) min = (*temp).value1;
         temp = (*temp).next;
     }
@@ -587,11 +923,13 @@ int min_list(node* head){
  * @return int The value to count the frequency of in the linked list
  */
 int count_frequents_in_list(node* head, int value){
+    INSTRUMENT_CALL(INSTRUMENT_COUNT_FREQUENTS_IN_LIST);
     if (!head) return 0;
 
     int freq = 0;
     node* temp = head;
     while(temp){
+        INSTRUMENT_VISIT();
         if((*temp).value1 == value) freq ++;
         temp = (*temp).next;
     }
@@ -599,38 +937,73 @@ int count_frequents_in_list(node* head, int value){
 }
 
 
+#define SORT_SLOTS 32 // the last slot takes every run longer than 2^30 nodes
+
+/**
+ * @brief Merges two sorted linked lists
+ * @details Helper of sort_list. Stable: for equal values the nodes of the first list come first.
+ * Time complexity: O(n + m), n and m = number of nodes in the lists
+ * @param head1 Pointer to the head of the first sorted list
+ * @param head2 Pointer to the head of the second sorted list
+ * @return node* Pointer to the head of the merged list
+ */
+node* merge_runs(node* head1, node* head2){
+    INSTRUMENT_CALL(INSTRUMENT_MERGE_RUNS);
+    node merged; // placeholder before the first node
+    node* last = &merged;
+
+    while (head1 && head2){
+        INSTRUMENT_VISIT();
+        if ((*head2).value1 < (*head1).value1){
+            (*last).next = head2;
+            head2 = (*head2).next;
+        } else {
+            (*last).next = head1;
+            head1 = (*head1).next;
+        }
+        last = (*last).next;
+    }
+    (*last).next = head1 ? head1 : head2;
+    return merged.next;
+}
+
+
 /**
  * @brief Sorts a linked list
- * @details Uses the quicksort algorithm for sorting the list.
- * (algorithm: https://www.geeksforgeeks.org/quick-sort-algorithm
+ * @details Uses the bottom-up merge sort without recursion: the slot i holds a sorted run of 2^i nodes,
+ * each node taken from the list is merged with the full slots like a binary counter,
+ * then the slots are merged together. Stable, with a fixed array of SORT_SLOTS pointers as extra memory;
+ * the merges work on recently touched nodes, so they stay in cache longer than merging runs of 1, 2, 4, ...
+ * nodes over the whole list at every pass.
+ * (algorithm: https://en.wikipedia.org/wiki/Merge_sort#Bottom-up_implementation_using_lists
  * other algorithms: https://en.wikipedia.org/wiki/Sorting_algorithm).
  * Time complexity: O(n log n), n = number of nodes in the list
  * @param head Pointer to the head of the linked list
  * @return node* Pointer to the head of the sorted linked list
  */
 node* sort_list(node* head){
-    if (!head || !(*head).next) return head; // base case
-
-    int pivot = (*head).value1;
-    node* left = NULL;
-    node* middle = NULL;
-    node* right = NULL;
-    node* temp = head;
-
-    while(temp){
-        node* next = (*temp).next;
-        (*temp).next = NULL;
+    INSTRUMENT_CALL(INSTRUMENT_SORT_LIST);
+    if (!head || !(*head).next) return head;
 
-        if ((*temp).value1 < pivot) left = insertion_head_node(left, temp);
-        else if ((*temp).value1 == pivot) middle = insertion_head_node(middle, temp);
-            else right = insertion_head_node(right, temp);
+    node* slots[SORT_SLOTS] = {NULL};
+    while (head){
+        INSTRUMENT_VISIT();
+        node* run = head;
+        head = (*head).next;
+        (*run).next = NULL;
 
-        temp = next;
+        int i = 0;
+        for (; i < SORT_SLOTS - 1 && slots[i]; i++){ // the runs in the slots are older: first for stability
+            run = merge_runs(slots[i], run);
+            slots[i] = NULL;
+        }
+        slots[i] = slots[i] ? merge_runs(slots[i], run) : run;
     }
-    left = sort_list(left);
-    right = sort_list(right);
-    middle = insertion_end_node(middle, right);
-    return insertion_end_node(left, middle);
+
+    node* sorted = NULL;
+    for (int i = 0; i < SORT_SLOTS; i++)
+        if (slots[i]) sorted = merge_runs(slots[i], sorted);
+    return sorted;
 }
 
 
@@ -643,6 +1016,7 @@ node* sort_list(node* head){
  * If memory allocation fails, the program exits with an error
  */
 int* list_values(node* head){
+    INSTRUMENT_CALL(INSTRUMENT_LIST_VALUES);
     if (!head) return NULL;
 
     int length = list_length(head);
@@ -655,6 +1029,7 @@ int* list_values(node* head){
     node* temp = head;
     int index = 0;
     while(temp){
+        INSTRUMENT_VISIT();
         values[index++] = (*temp).value1;
         temp = (*temp).next;
     }
@@ -667,14 +1042,2752 @@ int* list_values(node* head){
 
 
 
-// :::::::::::::::::::::::::::::::::::::::::::::::::::::: TESTS ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::: ARENA :::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 /**
- * @brief Entry point of the program, used for testing
- * @return 0 on successful execution
+ * @struct slab
+ * @brief Represent a block of nodes allocated together
+ * @details It has the number of nodes handed out, the number of nodes in the block,
+ * a pointer to the next slab of the arena and the nodes.
+ * Time complexity: O(1)
  */
-int main(){
-    return 0;
+typedef struct slab{
+    unsigned int used;
+    unsigned int capacity;
+    struct slab* next;
+    node nodes[]; // flexible array member, allocated with the slab
+} slab;
+
+/**
+ * @struct arena
+ * @brief Represent an allocator of nodes
+ * @details Nodes are taken from the first slab (one malloc every slab_nodes nodes),
+ * released nodes are kept in a free list (linked through next) and reused.
+ * Every node is released at once with clear_arena.
+ * Time complexity: O(1)
+ */
+typedef struct{
+    slab* slabs; // the first slab is the one in use
+    node* free_nodes;
+    unsigned int slab_nodes;
+} arena;
+
+const unsigned int DEFAULT_SLAB_NODES = 4096; // change to another default slab size
+
+
+/**
+ * @brief Create a new slab
+ * @details Time complexity: O(1)
+ * @warning If memory allocation fails prints an error and exit program
+ * @param capacity Number of nodes of the slab
+ * @return slab* Pointer to the new slab
+ */
+slab* create_slab(unsigned int capacity){
+    slab* new_slab = (slab*)malloc(sizeof(slab) + (size_t)capacity * sizeof(node)); // one allocation for every node
+    if (!new_slab) {
+        printf("Memory allocation failed\n");
+        exit(EXIT_FAILURE); // critical error
+    }
+
+    (*new_slab).used = 0;
+    (*new_slab).capacity = capacity;
+    (*new_slab).next = NULL;
+    return new_slab;
+}
+
+
+/**
+ * @brief Create a new arena
+ * @details Dynamically allocates memory for the arena, the first slab is allocated with the first node.
+ * Time complexity: O(1)
+ * @warning If memory allocation fails prints an error and exit program
+ * @param slab_nodes Number of nodes of each slab (0 for DEFAULT_SLAB_NODES)
+ * @return arena* Pointer to the new arena
+ */
+arena* create_arena(unsigned int slab_nodes){
+    arena* a = (arena*)malloc(sizeof(arena));
+    if (!a) {
+        printf("Memory allocation failed\n");
+        exit(EXIT_FAILURE); // critical error
+    }
+
+    (*a).slabs = NULL;
+    (*a).free_nodes = NULL;
+    (*a).slab_nodes = slab_nodes ? slab_nodes : DEFAULT_SLAB_NODES;
+    return a;
+}
+
+
+/**
+ * @brief Create a new node from an arena
+ * @details Reuses a released node if there is one, otherwise takes the next node of the current slab
+ * (a new slab is allocated when it is full).
+ * Time complexity: O(1)
+ * @warning The node must not be freed with free or clear_list
+ * @param a Pointer to the arena
+ * @param v1 The value of the node
+ * @return node* Pointer to the new node.
+ * If the arena is NULL returns NULL
+ */
+node* arena_create_node(arena* a, int v1){
+    if (!a) return NULL;
+
+    node* new_node = (*a).free_nodes;
+    if (new_node) (*a).free_nodes = (*new_node).next;
+    else {
+        if (!(*a).slabs || (*(*a).slabs).used == (*(*a).slabs).capacity){
+            slab* s = create_slab((*a).slab_nodes);
+            (*s).next = (*a).slabs;
+            (*a).slabs = s;
+        }
+        new_node = &(*(*a).slabs).nodes[(*(*a).slabs).used++];
+    }
+
+    (*new_node).value1 = v1;
+    (*new_node).next = NULL;
+    INSTRUMENT_ALLOCATIONS(1);
+    return new_node;
+}
+
+
+/**
+ * @brief Releases a node to its arena
+ * @details The node is added to the free list of the arena and reused by arena_create_node.
+ * Time complexity: O(1)
+ * @warning The node must belong to the arena and not be in a list
+ * @param a Pointer to the arena
+ * @param n Pointer to the node to release
+ * @return void Doesn't return a value
+ */
+void arena_free_node(arena* a, node* n){
+    if (!a || !n) return;
+
+    (*n).next = (*a).free_nodes;
+    (*a).free_nodes = n;
+    INSTRUMENT_FREES(1);
+}
+
+
+/**
+ * @brief Takes consecutive nodes from an arena
+ * @details Takes length consecutive nodes from one slab (a slab of at least length nodes is allocated if needed).
+ * The nodes are not initialized.
+ * Time complexity: O(1)
+ * @warning If memory allocation fails prints an error and exit program
+ * @param a Pointer to the arena
+ * @param length Number of nodes
+ * @return node* Pointer to the first node.
+ * If the arena is NULL or the length is zero returns NULL
+ */
+node* arena_reserve_nodes(arena* a, unsigned int length){
+    if (!a || length == 0) return NULL;
+
+    slab* s = (*a).slabs;
+    if (!s || (*s).capacity - (*s).used < length){
+        if (length <= (*a).slab_nodes){ // becomes the slab in use
+            s = create_slab((*a).slab_nodes);
+            (*s).next = (*a).slabs;
+            (*a).slabs = s;
+        } else { // dedicated slab, the slab in use stays first
+            s = create_slab(length);
+            if ((*a).slabs){
+                (*s).next = (*(*a).slabs).next;
+                (*(*a).slabs).next = s;
+            } else (*a).slabs = s;
+        }
+    }
+
+    node* first = &(*s).nodes[(*s).used];
+    (*s).used += length;
+    INSTRUMENT_ALLOCATIONS(length);
+    return first;
+}
+
+
+/**
+ * @brief Create a new linked list from an arena
+ * @details Takes length consecutive nodes from one slab (arena_reserve_nodes),
+ * so the list is stored contiguously in traversal order.
+ * Time complexity: O(n), n = number of nodes in the list
+ * @warning The nodes must not be freed with free or clear_list
+ * @param a Pointer to the arena
+ * @param values Array of values to initialize the linked list
+ * @param length Number of elements in the values array
+ * @return node* Pointer to the head of the linked list.
+ * If the arena or the values are NULL or the length is zero returns NULL
+ */
+node* arena_create_list(arena* a, int values[], unsigned int length){
+    if (!a || length == 0 || values == NULL) return NULL;
+
+    node* head = arena_reserve_nodes(a, length);
+    for (unsigned int i = 0; i < length; i++){
+        head[i].value1 = values[i];
+        head[i].next = &head[i + 1];
+    }
+    head[length - 1].next = NULL;
+    return head;
+}
+
+
+/**
+ * @brief Releases every node of a linked list to its arena
+ * @details The whole list is linked in front of the free list of the arena.
+ * Time complexity: O(n), n = number of nodes in the list
+ * @warning The nodes must belong to the arena
+ * @param a Pointer to the arena
+ * @param head Pointer to the head of the list
+ * @return void Doesn't return a value
+ */
+void arena_clear_list(arena* a, node* head){
+    if (!a || !head) return;
+
+    node* temp = head;
+    INSTRUMENT_FREES(1);
+    while ((*temp).next){
+        temp = (*temp).next;
+        INSTRUMENT_FREES(1);
+    }
+    (*temp).next = (*a).free_nodes;
+    (*a).free_nodes = head;
+}
+
+
+/**
+ * @brief Frees the memory allocated for an arena
+ * @details Deallocates every slab and the arena: every node of the arena is released
+ * without walking the lists.
+ * Time complexity: O(k), k = number of slabs (O(1) for lists created with arena_create_list)
+ * @param a Pointer to the arena
+ * @return void Doesn't return a value
+ */
+void clear_arena(arena* a){
+    if (!a) return;
+
+#if defined(LINKEDLIST_INSTRUMENT)
+    unsigned long long live = 0; // nodes still in use, freed with their slab
+    for (slab* s = (*a).slabs; s; s = (*s).next) live += (*s).used;
+    for (node* n = (*a).free_nodes; n; n = (*n).next) live--;
+    INSTRUMENT_FREES(live);
+#endif
+    slab* temp;
+    while ((*a).slabs){
+        temp = (*a).slabs;
+        (*a).slabs = (*temp).next;
+        free(temp); // deallocate memory
+    }
+    free(a);
+}
+
+
+
+
+// :::::::::::::::::::::::::::::::::::::::::::::::::: LINKED_LIST ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+/**
+ * @struct linked_list
+ * @brief Represent a linked list with its head, its tail and its length
+ * @details The linked_list_* functions keep the three fields up to date,
+ * so appending, concatenating and reading the length are O(1).
+ * Time complexity: O(1)
+ */
+typedef struct{
+    node* head;
+    node* tail;
+    unsigned int length;
+} linked_list;
+
+
+/**
+ * @brief Create a new linked list
+ * @details Dynamically allocates memory for each node of the list.
+ * Time complexity: O(n), n = number of nodes in the list
+ * @warning If memory allocation fails prints an error and exit program
+ * @param values Array of values to initialize the linked list
+ * @param length Number of elements in the values array
+ * @return linked_list The new linked list.
+ * If the argument is NULL or the length is zero returns an empty list
+ */
+linked_list linked_list_create(int values[], unsigned int length){
+    linked_list l = {NULL, NULL, 0};
+    if (length == 0 || values == NULL) return l;
+
+    l.head = create_list(values, length);
+    l.tail = l.head;
+    while ((*l.tail).next) l.tail = (*l.tail).next;
+    l.length = length;
+    return l;
+}
+
+
+/**
+ * @brief Prints the values of each node of the linked list
+ * @details Time complexity: O(n), n = number of nodes in the list
+ * @param l Pointer to the linked list
+ * @return void Doesn't return a value
+ */
+void linked_list_print(linked_list* l){
+    if (!l) return;
+    print_list((*l).head);
+}
+
+
+/**
+ * @brief Frees the memory allocated for the nodes of a linked list
+ * @details The list becomes empty.
+ * Time complexity: O(n), n = number of nodes in the list
+ * @param l Pointer to the linked list
+ * @return void Doesn't return a value
+ */
+void linked_list_clear(linked_list* l){
+    if (!l) return;
+
+    clear_list((*l).head);
+    (*l).head = (*l).tail = NULL;
+    (*l).length = 0;
+}
+
+
+/**
+ * @brief Insert a node at the head of a linked list
+ * @details Time complexity: O(1)
+ * @param l Pointer to the linked list
+ * @param n Pointer to the node to be inserted at the head
+ * @return void Doesn't return a value
+ */
+void linked_list_insertion_head_node(linked_list* l, node* n){
+    if (!l || !n) return;
+
+    (*n).next = (*l).head;
+    (*l).head = n;
+    if (!(*l).tail) (*l).tail = n;
+    (*l).length++;
+}
+
+
+/**
+ * @brief Insert a node at the end of a linked list
+ * @details Links the node after the tail.
+ * Time complexity: O(1)
+ * @param l Pointer to the linked list
+ * @param n Pointer to the node to be inserted at the end
+ * @return void Doesn't return a value
+ */
+void linked_list_insertion_end_node(linked_list* l, node* n){
+    if (!l || !n) return;
+
+    (*n).next = NULL;
+    if ((*l).tail) (*(*l).tail).next = n;
+    else (*l).head = n;
+    (*l).tail = n;
+    (*l).length++;
+}
+
+
+/**
+ * @brief Insert a node after another node of a linked list
+ * @details Time complexity: O(1) if n is the tail, otherwise O(n), n = number of nodes seen in the list
+ * @param l Pointer to the linked list
+ * @param n Pointer to the node after which the new node will be inserted
+ * @param after_n Pointer to the node to be inserted after the other node
+ * @return int 1 if the node is inserted, 0 if n is not in the list
+ */
+int linked_list_insertion_after_node(linked_list* l, node* n, node* after_n){
+    if (!l || !n || !after_n) return 0;
+
+    if (n == (*l).tail){
+        linked_list_insertion_end_node(l, after_n);
+        return 1;
+    }
+
+    node* temp = (*l).head;
+    while (temp && temp != n) temp = (*temp).next;
+    if (!temp) return 0;
+
+    (*after_n).next = (*temp).next;
+    (*temp).next = after_n;
+    (*l).length++;
+    return 1;
+}
+
+
+/**
+ * @brief Insert a node before another node of a linked list
+ * @details Time complexity: O(1) if n is the head, otherwise O(n), n = number of nodes seen in the list
+ * @param l Pointer to the linked list
+ * @param n Pointer to the node before which the new node will be inserted
+ * @param before_n Pointer to the node to be inserted before the other node
+ * @return int 1 if the node is inserted, 0 if n is not in the list
+ */
+int linked_list_insertion_before_node(linked_list* l, node* n, node* before_n){
+    if (!l || !n || !before_n || !(*l).head) return 0;
+
+    if (n == (*l).head){
+        linked_list_insertion_head_node(l, before_n);
+        return 1;
+    }
+
+    node* temp = (*l).head;
+    while ((*temp).next && (*temp).next != n) temp = (*temp).next;
+    if (!(*temp).next) return 0;
+
+    (*before_n).next = n;
+    (*temp).next = before_n;
+    (*l).length++;
+    return 1;
+}
+
+
+/**
+ * @brief Concatenates two linked lists
+ * @details Links the head of the second list after the tail of the first list,
+ * the second list becomes empty.
+ * Time complexity: O(1)
+ * @param l1 Pointer to the first linked list
+ * @param l2 Pointer to the second linked list
+ * @return void Doesn't return a value
+ */
+void linked_list_concatenate(linked_list* l1, linked_list* l2){
+    if (!l1 || !l2 || l1 == l2 || !(*l2).head) return;
+
+    if ((*l1).tail) (*(*l1).tail).next = (*l2).head;
+    else (*l1).head = (*l2).head;
+    (*l1).tail = (*l2).tail;
+    (*l1).length += (*l2).length;
+
+    (*l2).head = (*l2).tail = NULL;
+    (*l2).length = 0;
+}
+
+
+/**
+ * @brief Splits a linked list in two linked list at a specified node
+ * @details The first part (kept in l) includes all nodes up to and including the specified node,
+ * and the second part includes all nodes after it.
+ * Time complexity: O(n), n = number of nodes before the specified node
+ * @param l Pointer to the linked list
+ * @param n Pointer to the node at which the list will be split
+ * @return linked_list The second part of the list.
+ * If the specified node is not found, the second part is empty
+ */
+linked_list linked_list_split_at_node(linked_list* l, node* n){
+    linked_list second = {NULL, NULL, 0};
+    if (!l || !n) return second;
+
+    unsigned int position = 1;
+    node* temp = (*l).head;
+    while (temp && temp != n){
+        temp = (*temp).next;
+        position++;
+    }
+    if (!temp || temp == (*l).tail) return second; // n not found or nothing after it
+
+    second.head = (*temp).next;
+    second.tail = (*l).tail;
+    second.length = (*l).length - position;
+    (*temp).next = NULL;
+    (*l).tail = temp;
+    (*l).length = position;
+    return second;
+}
+
+/**
+ * @brief Splits a linked list in two linked list at a specified value
+ * @details The first part (kept in l) includes all nodes up to and including the first node with the specified value,
+ * and the second part includes all nodes after it.
+ * Time complexity: O(n), n = number of nodes before the specified value
+ * @param l Pointer to the linked list
+ * @param value Value of the node at which the list will be split
+ * @return linked_list The second part of the list.
+ * If the specified value is not found, the second part is empty
+ */
+linked_list linked_list_split_at_value(linked_list* l, int value){
+    linked_list second = {NULL, NULL, 0};
+    if (!l) return second;
+
+    node* temp = (*l).head;
+    while (temp && (*temp).value1 != value) temp = (*temp).next;
+    if (!temp) return second;
+    return linked_list_split_at_node(l, temp);
+}
+
+
+/**
+ * @brief Remove a node of a linked list
+ * @details Time complexity: O(1) if n is the head, otherwise O(n), n = number of nodes seen in the list
+ * @param l Pointer to the linked list
+ * @param n Pointer to the node to be removed from the linked list
+ * @return node* Pointer to the removed node.
+ * If the node is not found returns NULL
+ */
+node* linked_list_remove_node(linked_list* l, node* n){
+    if (!l || !n || !(*l).head) return NULL;
+
+    if (n == (*l).head){
+        (*l).head = (*n).next;
+        if (!(*l).head) (*l).tail = NULL;
+    } else {
+        node* temp = (*l).head;
+        while ((*temp).next && (*temp).next != n) temp = (*temp).next;
+        if (!(*temp).next) return NULL; // n not found
+
+        (*temp).next = (*n).next;
+        if (n == (*l).tail) (*l).tail = temp;
+    }
+    (*n).next = NULL;
+    (*l).length--;
+    return n;
+}
+
+/**
+ * @brief Remove the first node of the linked list with the value equals to the argument
+ * @details Time complexity: O(n), n = number of nodes seen in the list
+ * @param l Pointer to the linked list
+ * @param value The value of the node to be removed from the linked list
+ * @return node* Pointer to the removed node.
+ * If the value is not found returns NULL
+ */
+node* linked_list_remove_node_with_value(linked_list* l, int value){
+    if (!l || !(*l).head) return NULL;
+
+    node* prev = NULL;
+    node* temp = (*l).head;
+    while (temp && (*temp).value1 != value){
+        prev = temp;
+        temp = (*temp).next;
+    }
+    if (!temp) return NULL; // value not found
+
+    if (prev) (*prev).next = (*temp).next;
+    else (*l).head = (*temp).next;
+    if (temp == (*l).tail) (*l).tail = prev;
+    (*temp).next = NULL;
+    (*l).length--;
+    return temp;
+}
+
+
+/**
+ * @brief Changes the value of a node in a linked list
+ * @details Time complexity: O(n), n = number of nodes seen in the list
+ * @param l Pointer to the linked list
+ * @param n Pointer to the node whose value is to be changed
+ * @param new_value The new value to be assigned to the node
+ * @return node* Pointer to the changed node.
+ * If the node is not found returns NULL
+ */
+node* linked_list_change_node_value(linked_list* l, node* n, int new_value){
+    if (!l || !n) return NULL;
+
+    if (n == (*l).tail){
+        (*n).value1 = new_value;
+        return n;
+    }
+    tuple found = node_in_list((*l).head, n);
+    if (!found.node2) return NULL;
+    (*n).value1 = new_value;
+    return n;
+}
+
+/**
+ * @brief Changes the value of the first node of a linked list with a value
+ * @details Time complexity: O(n), n = number of nodes seen in the list
+ * @param l Pointer to the linked list
+ * @param value The value of the node to be changed
+ * @param new_value The new value to be assigned to the node
+ * @return node* Pointer to the changed node.
+ * If the value is not found returns NULL
+ */
+node* linked_list_change_node_value_with_value(linked_list* l, int value, int new_value){
+    if (!l) return NULL;
+
+    node* n = value_in_list((*l).head, value).node2;
+    if (n) (*n).value1 = new_value;
+    return n;
+}
+
+
+/**
+ * @brief Checks if a linked list is empty
+ * @details Time complexity: O(1)
+ * @param l Pointer to the linked list
+ * @return int Returns 1 if the list is empty, otherwise returns 0
+ */
+int linked_list_is_empty(linked_list* l){
+    return !l || (*l).length == 0;
+}
+
+
+/**
+ * @brief Searches for a node in a linked list
+ * @details Time complexity: O(1) if n is the head or the tail, otherwise O(n), n = number of nodes seen in the list
+ * @param l Pointer to the linked list
+ * @param n Pointer to the node to be searched for in the list
+ * @return node* Pointer to the found node.
+ * If the node is not found returns NULL
+ */
+node* linked_list_node_in(linked_list* l, node* n){
+    if (!l || !n) return NULL;
+    if (n == (*l).head || n == (*l).tail) return n;
+
+    node* temp = (*l).head;
+    while (temp && temp != n) temp = (*temp).next;
+    return temp;
+}
+
+/**
+ * @brief Searches for a value in a linked list
+ * @details Time complexity: O(n), n = number of nodes seen in the list
+ * @param l Pointer to the linked list
+ * @param value Value to be searched for in the list
+ * @return node* Pointer to the first node with the searched value.
+ * If the value is not found returns NULL
+ */
+node* linked_list_value_in(linked_list* l, int value){
+    if (!l) return NULL;
+    return value_in_list((*l).head, value).node2;
+}
+
+
+/**
+ * @brief Reverses a linked list
+ * @details The head becomes the tail.
+ * Time complexity: O(n), n = number of nodes in the list
+ * @param l Pointer to the linked list
+ * @return void Doesn't return a value
+ */
+void linked_list_reverse(linked_list* l){
+    if (!l) return;
+
+    (*l).tail = (*l).head;
+    (*l).head = reverse_list((*l).head);
+}
+
+
+/**
+ * @brief Length of a linked list
+ * @details Time complexity: O(1)
+ * @param l Pointer to the linked list
+ * @return unsigned int The length of the linked list
+ */
+unsigned int linked_list_length(linked_list* l){
+    return l ? (*l).length : 0;
+}
+
+
+/**
+ * @brief Max value of a linked list
+ * @details Time complexity: O(n), n = number of nodes in the list
+ * @param l Pointer to the linked list
+ * @return int The max value of the linked list.
+ * If the list is empty return the default value of a node
+ */
+int linked_list_max(linked_list* l){
+    return l ? max_list((*l).head) : DEFAULT_VALUE;
+}
+
+/**
+ * @brief Min value of a linked list
+ * @details Time complexity: O(n), n = number of nodes in the list
+ * @param l Pointer to the linked list
+ * @return int The min value of the linked list.
+ * If the list is empty return the default value of a node
+ */
+int linked_list_min(linked_list* l){
+    return l ? min_list((*l).head) : DEFAULT_VALUE;
+}
+
+
+/**
+ * @brief Counts the frequency of a value in the linked list
+ * @details Time complexity: O(n), n = number of nodes in the list
+ * @param l Pointer to the linked list
+ * @param value The value to count the frequency of in the linked list
+ * @return int The frequency of the value
+ */
+int linked_list_count_frequents(linked_list* l, int value){
+    return l ? count_frequents_in_list((*l).head, value) : 0;
+}
+
+
+/**
+ * @brief Sorts a linked list
+ * @details Sorts with sort_list, then finds the new tail.
+ * Time complexity: as sort_list, plus O(n), n = number of nodes in the list
+ * @param l Pointer to the linked list
+ * @return void Doesn't return a value
+ */
+void linked_list_sort(linked_list* l){
+    if (!l || !(*l).head) return;
+
+    (*l).head = sort_list((*l).head);
+    (*l).tail = (*l).head;
+    while ((*(*l).tail).next) (*l).tail = (*(*l).tail).next;
+}
+
+
+/**
+ * @brief Extracts the values from a linked list into an array
+ * @details The length is already known, so the list is walked once.
+ * Time complexity: O(n), n = number of nodes in the list
+ * @param l Pointer to the linked list
+ * @return int* Pointer to an array containing the values of the linked list nodes.
+ * If the list is empty, returns NULL.
+ * If memory allocation fails, the program exits with an error
+ */
+int* linked_list_values(linked_list* l){
+    if (!l || !(*l).head) return NULL;
+
+    int* values = (int*)malloc((*l).length * sizeof(int)); // dynamic allocation for the values
+    if (!values) {
+        printf("Memory allocation failed\n");
+        exit(EXIT_FAILURE); // critical error
+    }
+
+    node* temp = (*l).head;
+    for (unsigned int i = 0; temp; i++){
+        values[i] = (*temp).value1;
+        temp = (*temp).next;
+    }
+    return values;
+}
+
+
+
+
+// :::::::::::::::::::::::::::::::::::::::::::::::::: AGGREGATES :::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+#define AGGREGATE_MIN 1
+#define AGGREGATE_MAX 2
+#define AGGREGATE_LENGTH 4
+#define AGGREGATE_FREQUENCY 8
+#define AGGREGATE_ALL (AGGREGATE_MIN | AGGREGATE_MAX | AGGREGATE_LENGTH | AGGREGATE_FREQUENCY)
+#define PREFETCH_DISTANCE 4 // nodes between the one read and the one prefetched
+
+#if defined(__GNUC__)
+#define PREFETCH(address) __builtin_prefetch(address)
+#else
+#define PREFETCH(address) ((void)(address))
+#endif
+
+/**
+ * @struct aggregates
+ * @brief Represent the aggregates of a linked list computed together
+ * @details Fields not requested keep the default value of a node (min, max) or 0 (length, frequency).
+ * Time complexity: O(1)
+ */
+typedef struct{
+    int min;
+    int max;
+    int length;
+    int frequency; // occurrences of the value passed to the aggregate functions
+} aggregates;
+
+
+/**
+ * @brief Computes several aggregates of a linked list in one traversal
+ * @details Replaces separate calls to min_list, max_list, list_length and count_frequents_in_list.
+ * Only the requested aggregates are computed: the tests on which don't change in the loop,
+ * so the compiler can move them out of it (with AGGREGATE_LENGTH alone the values are not read).
+ * A lookahead pointer runs PREFETCH_DISTANCE nodes ahead and each node it reaches is prefetched,
+ * so the cache misses of the following nodes overlap with the work on the current one;
+ * advancing it reads the next field of the node prefetched in the previous step.
+ * Time complexity: O(n), n = number of nodes in the list
+ * @param head Pointer to the head of the linked list
+ * @param which Combination of AGGREGATE_MIN, AGGREGATE_MAX, AGGREGATE_LENGTH and AGGREGATE_FREQUENCY
+ * @param value The value whose frequency is counted
+ * @return aggregates The requested aggregates.
+ * If the list is empty min and max are the default value of a node
+ */
+aggregates aggregate_list(node* head, unsigned int which, int value){
+    aggregates result = {DEFAULT_VALUE, DEFAULT_VALUE, 0, 0};
+    if (!head || !(which & AGGREGATE_ALL)) return result;
+
+    int min = (*head).value1, max = (*head).value1, length = 0, frequency = 0;
+    node* ahead = head;
+    for (int i = 0; i < PREFETCH_DISTANCE && ahead; i++) ahead = (*ahead).next;
+
+    node* temp = head;
+    while (temp){
+        if (ahead){
+            ahead = (*ahead).next; // prefetched in the previous step
+            PREFETCH(ahead); // a prefetch of NULL doesn't fault
+        }
+        if (which & (AGGREGATE_MIN | AGGREGATE_MAX | AGGREGATE_FREQUENCY)){
+            int v = (*temp).value1;
+            if ((which & AGGREGATE_MIN) && v < min) min = v;
+            if ((which & AGGREGATE_MAX) && v > max) max = v;
+            if (which & AGGREGATE_FREQUENCY) frequency += v == value;
+        }
+        length++;
+        temp = (*temp).next;
+    }
+
+    if (which & AGGREGATE_MIN) result.min = min;
+    if (which & AGGREGATE_MAX) result.max = max;
+    if (which & AGGREGATE_LENGTH) result.length = length;
+    if (which & AGGREGATE_FREQUENCY) result.frequency = frequency;
+    return result;
+}
+
+
+/**
+ * @brief Computes several aggregates of an array of values in one pass
+ * @details For values already in an array (e.g. from list_values).
+ * Uses AVX2 (8 values for each instruction) or SSE2 (4 values) when the compiler targets them,
+ * otherwise a scalar loop.
+ * Time complexity: O(n), n = length
+ * @param values Array of values
+ * @param length Number of elements in the values array
+ * @param which Combination of AGGREGATE_MIN, AGGREGATE_MAX, AGGREGATE_LENGTH and AGGREGATE_FREQUENCY
+ * @param value The value whose frequency is counted
+ * @return aggregates The requested aggregates.
+ * If the array is empty min and max are the default value of a node
+ */
+aggregates aggregate_values(const int values[], unsigned int length, unsigned int which, int value){
+    aggregates result = {DEFAULT_VALUE, DEFAULT_VALUE, 0, 0};
+    if (!values || length == 0) return result;
+
+    int min = values[0], max = values[0], frequency = 0;
+    unsigned int i = 0;
+
+#if defined(__AVX2__)
+    if (length >= 8){
+        __m256i vmin = _mm256_set1_epi32(values[0]), vmax = vmin;
+        __m256i vcount = _mm256_setzero_si256(), vvalue = _mm256_set1_epi32(value);
+        for (; i + 8 <= length; i += 8){
+            __m256i v = _mm256_loadu_si256((const __m256i*)(values + i));
+            vmin = _mm256_min_epi32(vmin, v);
+            vmax = _mm256_max_epi32(vmax, v);
+            vcount = _mm256_sub_epi32(vcount, _mm256_cmpeq_epi32(v, vvalue)); // equal lanes are -1
+        }
+        int lanes_min[8], lanes_max[8], lanes_count[8];
+        _mm256_storeu_si256((__m256i*)lanes_min, vmin);
+        _mm256_storeu_si256((__m256i*)lanes_max, vmax);
+        _mm256_storeu_si256((__m256i*)lanes_count, vcount);
+        for (int k = 0; k < 8; k++){
+            if (lanes_min[k] < min) min = lanes_min[k];
+            if (lanes_max[k] > max) max = lanes_max[k];
+            frequency += lanes_count[k];
+        }
+    }
+#elif defined(__SSE2__)
+    if (length >= 4){
+        __m128i vmin = _mm_set1_epi32(values[0]), vmax = vmin;
+        __m128i vcount = _mm_setzero_si128(), vvalue = _mm_set1_epi32(value);
+        for (; i + 4 <= length; i += 4){
+            __m128i v = _mm_loadu_si128((const __m128i*)(values + i));
+            __m128i less = _mm_cmplt_epi32(v, vmin); // SSE2 has no min/max on 32 bits integers
+            vmin = _mm_or_si128(_mm_and_si128(less, v), _mm_andnot_si128(less, vmin));
+            __m128i greater = _mm_cmpgt_epi32(v, vmax);
+            vmax = _mm_or_si128(_mm_and_si128(greater, v), _mm_andnot_si128(greater, vmax));
+            vcount = _mm_sub_epi32(vcount, _mm_cmpeq_epi32(v, vvalue)); // equal lanes are -1
+        }
+        int lanes_min[4], lanes_max[4], lanes_count[4];
+        _mm_storeu_si128((__m128i*)lanes_min, vmin);
+        _mm_storeu_si128((__m128i*)lanes_max, vmax);
+        _mm_storeu_si128((__m128i*)lanes_count, vcount);
+        for (int k = 0; k < 4; k++){
+            if (lanes_min[k] < min) min = lanes_min[k];
+            if (lanes_max[k] > max) max = lanes_max[k];
+            frequency += lanes_count[k];
+        }
+    }
+#endif
+
+    for (; i < length; i++){ // remaining values (all of them without SIMD)
+        if (values[i] < min) min = values[i];
+        if (values[i] > max) max = values[i];
+        frequency += values[i] == value;
+    }
+
+    if (which & AGGREGATE_MIN) result.min = min;
+    if (which & AGGREGATE_MAX) result.max = max;
+    if (which & AGGREGATE_LENGTH) result.length = (int)length;
+    if (which & AGGREGATE_FREQUENCY) result.frequency = frequency;
+    return result;
+}
+
+
+
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::: PARALLEL_SORT :::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+#define MAX_SORT_THREADS 64
+#define MIN_SEGMENT_NODES 16384 // shorter lists are sorted by one thread
+
+/**
+ * @struct sort_task
+ * @brief Represent the work of one thread of sort_list_parallel
+ * @details Sorting: head1 is the segment to sort. Merging: head1 and head2 are the sorted lists to merge.
+ * The result is written in head1.
+ * Time complexity: O(1)
+ */
+typedef struct{
+    node* head1;
+    node* head2;
+} sort_task;
+
+
+/**
+ * @brief Thread function sorting one segment
+ * @details Time complexity: as sort_list
+ * @param arg Pointer to the sort_task
+ * @return void* NULL
+ */
+void* sort_segment_worker(void* arg){
+    sort_task* task = (sort_task*)arg;
+    (*task).head1 = sort_list((*task).head1);
+    return NULL;
+}
+
+
+/**
+ * @brief Thread function merging two sorted segments
+ * @details Time complexity: as merge_runs
+ * @param arg Pointer to the sort_task
+ * @return void* NULL
+ */
+void* merge_segments_worker(void* arg){
+    sort_task* task = (sort_task*)arg;
+    (*task).head1 = merge_runs((*task).head1, (*task).head2);
+    return NULL;
+}
+
+
+/**
+ * @brief Runs the tasks concurrently, one for each thread
+ * @details The last task runs on the calling thread.
+ * If a thread can't be created its task runs on the calling thread too.
+ * Time complexity: the time of the longest task
+ * @param worker Thread function, called with a pointer to a task
+ * @param tasks Array of the tasks
+ * @param task_size Size of a task in bytes
+ * @param count Number of tasks (at most MAX_SORT_THREADS)
+ * @return void Doesn't return a value
+ */
+void run_tasks(void* (*worker)(void*), void* tasks, size_t task_size, unsigned int count){
+    if (count == 0) return;
+    pthread_t ids[MAX_SORT_THREADS];
+    int started[MAX_SORT_THREADS];
+    char* task = (char*)tasks;
+
+    for (unsigned int i = 0; i + 1 < count; i++){
+        started[i] = pthread_create(&ids[i], NULL, worker, task + i * task_size) == 0;
+        if (!started[i]) worker(task + i * task_size);
+    }
+    worker(task + (count - 1) * task_size);
+    for (unsigned int i = 0; i + 1 < count; i++) if (started[i]) pthread_join(ids[i], NULL);
+}
+
+
+/**
+ * @brief Sorts a linked list with several threads
+ * @details Cuts the list into one segment for each thread, sorts the segments concurrently with sort_list,
+ * then merges them in pairs with a merge tree, each level in parallel.
+ * The segments keep the order of the list and the merges are stable,
+ * so the result is the same list as sort_list.
+ * Time complexity: O(n log n / t + n), n = number of nodes in the list, t = threads
+ * @param head Pointer to the head of the linked list
+ * @param threads Number of threads (at most MAX_SORT_THREADS)
+ * @return node* Pointer to the head of the sorted linked list
+ */
+node* sort_list_parallel(node* head, unsigned int threads){
+    if (threads > MAX_SORT_THREADS) threads = MAX_SORT_THREADS;
+    unsigned int length = (unsigned int)list_length(head);
+    if (threads <= 1 || length < threads * MIN_SEGMENT_NODES) return sort_list(head);
+
+    sort_task tasks[MAX_SORT_THREADS];
+    node* rest = head;
+    for (unsigned int t = 0; t < threads; t++){
+        unsigned int size = length / threads + (t < length % threads);
+        node* last = rest;
+        for (unsigned int i = 1; i < size; i++) last = (*last).next;
+        tasks[t].head1 = rest;
+        tasks[t].head2 = NULL;
+        rest = (*last).next;
+        (*last).next = NULL;
+    }
+    run_tasks(sort_segment_worker, tasks, sizeof(sort_task), threads);
+
+    for (unsigned int segments = threads; segments > 1; segments = (segments + 1) / 2){
+        sort_task merges[MAX_SORT_THREADS / 2];
+        unsigned int pairs = segments / 2;
+        for (unsigned int p = 0; p < pairs; p++){
+            merges[p].head1 = tasks[2 * p].head1; // the earlier segment first, for stability
+            merges[p].head2 = tasks[2 * p + 1].head1;
+        }
+        run_tasks(merge_segments_worker, merges, sizeof(sort_task), pairs);
+        for (unsigned int p = 0; p < pairs; p++) tasks[p].head1 = merges[p].head1;
+        if (segments % 2) tasks[pairs].head1 = tasks[segments - 1].head1; // the odd one moves up a level
+    }
+    return tasks[0].head1;
+}
+
+
+
+
+// :::::::::::::::::::::::::::::::::::::::::::::::::: RADIX_SORT ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+#define RADIX_BITS 8
+#define RADIX_BUCKETS (1 << RADIX_BITS)
+#define RADIX_STREAMS 8 // parts of the list walked together at each pass
+#define RADIX_MIN_NODES 2048 // shorter lists are sorted faster by sort_list (see benchmark_radix_sort)
+
+/**
+ * @struct radix_chains
+ * @brief Represent the chains of nodes of one pass of radix_sort_list, one for each digit
+ * Time complexity: O(1)
+ */
+typedef struct{
+    node* heads[RADIX_BUCKETS];
+    node* tails[RADIX_BUCKETS];
+    unsigned int counts[RADIX_BUCKETS];
+} radix_chains;
+
+
+/**
+ * @brief Appends a node to the chain of its digit
+ * @details Helper of radix_sort_list.
+ * Time complexity: O(1)
+ * @param c Pointer to the chains
+ * @param n Pointer to the node
+ * @param digit The digit of the value of the node
+ * @return void Doesn't return a value
+ */
+void radix_append(radix_chains* c, node* n, unsigned int digit){
+    if ((*c).heads[digit]) (*(*c).tails[digit]).next = n;
+    else (*c).heads[digit] = n;
+    (*c).tails[digit] = n;
+    (*c).counts[digit]++;
+}
+
+
+/**
+ * @brief Sorts a linked list by the bits of the values
+ * @details LSD radix sort: at each pass the nodes are appended to the chain of their digit
+ * (RADIX_BITS bits, from the least significant) and the chains are relinked in order.
+ * The sign bit is flipped, so negative values come first.
+ * A first pass finds the bits that are equal in all the values: their digits are skipped.
+ * After a pass the nodes are scattered in memory, so the next pass walks RADIX_STREAMS parts
+ * of the list together (each one with its chains, relinked in order): the cache misses of the parts overlap.
+ * No comparisons between values, stable, extra memory only for the tables of the chains.
+ * (algorithm: https://en.wikipedia.org/wiki/Radix_sort#Least_significant_digit).
+ * Time complexity: O(n * d), n = number of nodes in the list, d = number of digits that change (at most 4)
+ * @param head Pointer to the head of the linked list
+ * @return node* Pointer to the head of the sorted linked list
+ */
+node* radix_sort_list(node* head){
+    if (!head || !(*head).next) return head;
+
+    const unsigned int sign = 1u << (sizeof(int) * 8 - 1);
+    unsigned int all_ones = ~0u, any_one = 0, length = 0;
+    for (node* temp = head; temp; temp = (*temp).next){
+        unsigned int key = (unsigned int)(*temp).value1 ^ sign;
+        all_ones &= key;
+        any_one |= key;
+        length++;
+    }
+    unsigned int changing = all_ones ^ any_one; // bits that are not the same in all the values
+
+    radix_chains chains[RADIX_STREAMS];
+    node* starts[RADIX_STREAMS] = {head};
+    unsigned int begins[RADIX_STREAMS + 1] = {0};
+    int streams = 1; // the first pass walks the list as it is
+    for (unsigned int shift = 0; shift < sizeof(int) * 8; shift += RADIX_BITS){
+        if (!((changing >> shift) & (RADIX_BUCKETS - 1))) continue; // every node would go in the same chain
+
+        begins[streams] = length;
+        unsigned int left[RADIX_STREAMS];
+        for (int s = 0; s < streams; s++){
+            memset(chains[s].heads, 0, sizeof(chains[s].heads));
+            memset(chains[s].counts, 0, sizeof(chains[s].counts));
+            left[s] = begins[s + 1] - begins[s];
+        }
+        for (int active = 1; active; ){
+            active = 0;
+            for (int s = 0; s < streams; s++){
+                if (!left[s]) continue;
+                node* temp = starts[s];
+                starts[s] = (*temp).next;
+                left[s]--;
+                radix_append(&chains[s], temp, (((unsigned int)(*temp).value1 ^ sign) >> shift) & (RADIX_BUCKETS - 1));
+                active = 1;
+            }
+        }
+
+        node* last = NULL;
+        unsigned int done = 0;
+        int next_streams = 0;
+        for (int digit = 0; digit < RADIX_BUCKETS; digit++){
+            for (int s = 0; s < streams; s++){
+                node* chain = chains[s].heads[digit];
+                if (!chain) continue;
+                if (next_streams < RADIX_STREAMS && done >= next_streams * (length / RADIX_STREAMS)){
+                    starts[next_streams] = chain; // a part of the next pass starts here
+                    begins[next_streams++] = done;
+                }
+                if (last) (*last).next = chain;
+                else head = chain;
+                last = chains[s].tails[digit];
+                done += chains[s].counts[digit];
+            }
+        }
+        (*last).next = NULL;
+        streams = next_streams;
+    }
+    return head;
+}
+
+
+/**
+ * @brief Sorts a linked list with radix_sort_list or sort_list
+ * @details Short lists (less than RADIX_MIN_NODES nodes) are sorted by sort_list,
+ * where the passes of the radix sort over the tables of the chains cost more than the comparisons.
+ * Both are stable, so the result is the same.
+ * Time complexity: O(n log n) for short lists, O(n) for the others, n = number of nodes in the list
+ * @param head Pointer to the head of the linked list
+ * @return node* Pointer to the head of the sorted linked list
+ */
+node* sort_list_adaptive(node* head){
+    unsigned int length = 0;
+    for (node* temp = head; temp && length < RADIX_MIN_NODES; temp = (*temp).next) length++;
+    return length < RADIX_MIN_NODES ? sort_list(head) : radix_sort_list(head);
+}
+
+
+
+
+// :::::::::::::::::::::::::::::::::::::::::::::::::::: CURSOR ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+/**
+ * @struct cursor
+ * @brief Represent a position in a linked_list
+ * @details It has the list, the current node, the node before it and the position of the current node,
+ * so the operations at the cursor don't search the node before the current one from the head.
+ * After the last node the current node is NULL and prev is the tail.
+ * Only the cursor_* functions may change the list while the cursor is used.
+ * Time complexity: O(1)
+ */
+typedef struct{
+    linked_list* list;
+    node* prev; // NULL at the head
+    node* current; // NULL after the last node
+    unsigned int position; // number of nodes before current
+} cursor;
+
+
+/**
+ * @brief Create a cursor at the head of a linked list
+ * @details Time complexity: O(1)
+ * @param l Pointer to the linked list
+ * @return cursor The cursor on the first node (on the end if the list is empty)
+ */
+cursor cursor_begin(linked_list* l){
+    cursor c = {l, NULL, l ? (*l).head : NULL, 0};
+    return c;
+}
+
+
+/**
+ * @brief Moves a cursor to the next node
+ * @details Time complexity: O(1)
+ * @param c Pointer to the cursor
+ * @return int 1 if the cursor is on a node after the move, 0 if it is after the last node
+ */
+int cursor_next(cursor* c){
+    if (!c || !(*c).current) return 0;
+
+    (*c).prev = (*c).current;
+    (*c).current = (*(*c).current).next;
+    (*c).position++;
+    return (*c).current != NULL;
+}
+
+
+/**
+ * @brief Checks if a cursor is after the last node
+ * @details Time complexity: O(1)
+ * @param c Pointer to the cursor
+ * @return int 1 if the cursor has no current node, 0 otherwise
+ */
+int cursor_at_end(cursor* c){
+    return !c || !(*c).current;
+}
+
+
+/**
+ * @brief Insert a node before the current node of a cursor
+ * @details The cursor stays on its node, the new node becomes prev.
+ * After the last node the new node is appended at the end.
+ * Time complexity: O(1)
+ * @param c Pointer to the cursor
+ * @param n Pointer to the node to be inserted
+ * @return void Doesn't return a value
+ */
+void cursor_insertion_before(cursor* c, node* n){
+    if (!c || !(*c).list || !n) return;
+
+    (*n).next = (*c).current;
+    if ((*c).prev) (*(*c).prev).next = n;
+    else (*(*c).list).head = n;
+    if (!(*c).current) (*(*c).list).tail = n;
+    (*(*c).list).length++;
+    (*c).prev = n;
+    (*c).position++;
+}
+
+
+/**
+ * @brief Insert a node after the current node of a cursor
+ * @details The cursor stays on its node, the new node is the next one visited.
+ * Time complexity: O(1)
+ * @param c Pointer to the cursor
+ * @param n Pointer to the node to be inserted
+ * @return int 1 if the node is inserted, 0 if the cursor is after the last node
+ */
+int cursor_insertion_after(cursor* c, node* n){
+    if (!c || !(*c).list || !n || !(*c).current) return 0;
+
+    (*n).next = (*(*c).current).next;
+    (*(*c).current).next = n;
+    if ((*(*c).list).tail == (*c).current) (*(*c).list).tail = n;
+    (*(*c).list).length++;
+    return 1;
+}
+
+
+/**
+ * @brief Remove the current node of a cursor
+ * @details The cursor moves to the node after the removed one.
+ * Time complexity: O(1)
+ * @param c Pointer to the cursor
+ * @return node* Pointer to the removed node.
+ * If the cursor is after the last node returns NULL
+ */
+node* cursor_remove(cursor* c){
+    if (!c || !(*c).list || !(*c).current) return NULL;
+
+    node* n = (*c).current;
+    if ((*c).prev) (*(*c).prev).next = (*n).next;
+    else (*(*c).list).head = (*n).next;
+    if ((*(*c).list).tail == n) (*(*c).list).tail = (*c).prev;
+    (*(*c).list).length--;
+    (*c).current = (*n).next;
+    (*n).next = NULL;
+    return n;
+}
+
+
+/**
+ * @brief Splits the linked list of a cursor before the current node
+ * @details The list keeps the nodes before the cursor, the second part starts at the current node;
+ * the cursor stays at the end of the list.
+ * Time complexity: O(1)
+ * @param c Pointer to the cursor
+ * @return linked_list The second part of the list.
+ * If the cursor is after the last node, the second part is empty
+ */
+linked_list cursor_split(cursor* c){
+    linked_list second = {NULL, NULL, 0};
+    if (!c || !(*c).list || !(*c).current) return second;
+
+    linked_list* l = (*c).list;
+    second.head = (*c).current;
+    second.tail = (*l).tail;
+    second.length = (*l).length - (*c).position;
+    if ((*c).prev) (*(*c).prev).next = NULL;
+    else (*l).head = NULL;
+    (*l).tail = (*c).prev;
+    (*l).length = (*c).position;
+    (*c).current = NULL;
+    return second;
+}
+
+
+
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::: BULK ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+/**
+ * @brief Removes every node of a linked list with a value accepted by a predicate
+ * @details One walk keeping the node before the current one, the removed nodes are freed
+ * (released to the arena if there is one).
+ * Time complexity: O(n), n = number of nodes in the list
+ * @param l Pointer to the linked list
+ * @param a Pointer to the arena of the nodes, NULL if they were allocated with malloc
+ * @param predicate Function returning non zero for the values to remove (it also gets arg)
+ * @param arg Argument passed to the predicate
+ * @return unsigned int Number of removed nodes
+ */
+unsigned int linked_list_remove_if(linked_list* l, arena* a, int (*predicate)(int, void*), void* arg){
+    if (!l || !predicate) return 0;
+
+    unsigned int removed = 0;
+    node* prev = NULL;
+    node* temp = (*l).head;
+    while (temp){
+        node* next = (*temp).next;
+        if (predicate((*temp).value1, arg)){
+            if (prev) (*prev).next = next;
+            else (*l).head = next;
+            if (a) arena_free_node(a, temp);
+            else {
+                free(temp); // deallocate memory
+                INSTRUMENT_FREES(1);
+            }
+            removed++;
+        } else prev = temp;
+        temp = next;
+    }
+    (*l).tail = prev;
+    (*l).length -= removed;
+    return removed;
+}
+
+/**
+ * @brief Predicate of linked_list_remove_all_with_value
+ * @details Time complexity: O(1)
+ * @param value The value of a node
+ * @param arg Pointer to the value to remove (int*)
+ * @return int 1 if the values are equal, 0 otherwise
+ */
+int value_equals(int value, void* arg){
+    return value == *(int*)arg;
+}
+
+/**
+ * @brief Removes every node of a linked list with a value
+ * @details linked_list_remove_if with an equality predicate.
+ * Time complexity: O(n), n = number of nodes in the list
+ * @param l Pointer to the linked list
+ * @param a Pointer to the arena of the nodes, NULL if they were allocated with malloc
+ * @param value The value of the nodes to be removed
+ * @return unsigned int Number of removed nodes
+ */
+unsigned int linked_list_remove_all_with_value(linked_list* l, arena* a, int value){
+    return linked_list_remove_if(l, a, value_equals, &value);
+}
+
+
+/**
+ * @brief Moves the nodes of a linked list with a value accepted by a predicate to a new list
+ * @details One walk, the nodes are relinked (no allocation) and keep their order in both lists.
+ * Time complexity: O(n), n = number of nodes in the list
+ * @param l Pointer to the linked list
+ * @param predicate Function returning non zero for the values to move (it also gets arg)
+ * @param arg Argument passed to the predicate
+ * @return linked_list The list of the moved nodes
+ */
+linked_list linked_list_filter(linked_list* l, int (*predicate)(int, void*), void* arg){
+    linked_list moved = {NULL, NULL, 0};
+    if (!l || !predicate) return moved;
+
+    node* prev = NULL;
+    node* temp = (*l).head;
+    while (temp){
+        node* next = (*temp).next;
+        if (predicate((*temp).value1, arg)){
+            if (prev) (*prev).next = next;
+            else (*l).head = next;
+            (*temp).next = NULL;
+            if (moved.tail) (*moved.tail).next = temp;
+            else moved.head = temp;
+            moved.tail = temp;
+            moved.length++;
+        } else prev = temp;
+        temp = next;
+    }
+    (*l).tail = prev;
+    (*l).length -= moved.length;
+    return moved;
+}
+
+
+/**
+ * @brief Replaces each value of a linked list with the result of a function
+ * @details Time complexity: O(n), n = number of nodes in the list
+ * @param l Pointer to the linked list
+ * @param function Function from the old value (and arg) to the new value
+ * @param arg Argument passed to the function
+ * @return void Doesn't return a value
+ */
+void linked_list_map(linked_list* l, int (*function)(int, void*), void* arg){
+    if (!l || !function) return;
+
+    for (node* temp = (*l).head; temp; temp = (*temp).next) (*temp).value1 = function((*temp).value1, arg);
+}
+
+
+/**
+ * @brief Inserts the values of an array after a node of a linked list
+ * @details The new nodes are created as one list and linked in with two pointer changes:
+ * with an arena they are consecutive nodes of one slab (arena_create_list), otherwise one malloc for each node.
+ * Time complexity: O(m), m = number of values
+ * @warning after_n must be a node of the list (not checked, see linked_list_node_in)
+ * @warning If memory allocation fails prints an error and exit program
+ * @param l Pointer to the linked list
+ * @param a Pointer to the arena for the new nodes, NULL to allocate them with malloc
+ * @param after_n Pointer to the node after which the values are inserted, NULL to insert them at the head
+ * @param values Array of values to insert
+ * @param length Number of elements in the values array
+ * @return unsigned int Number of inserted nodes
+ */
+unsigned int linked_list_splice_values(linked_list* l, arena* a, node* after_n, int values[], unsigned int length){
+    if (!l || !values || length == 0) return 0;
+
+    node* first = a ? arena_create_list(a, values, length) : create_list(values, length);
+    node* last = first;
+    if (a) last = first + (length - 1); // consecutive nodes
+    else while ((*last).next) last = (*last).next;
+
+    if (after_n){
+        (*last).next = (*after_n).next;
+        (*after_n).next = first;
+        if (after_n == (*l).tail) (*l).tail = last;
+    } else {
+        (*last).next = (*l).head;
+        (*l).head = first;
+        if (!(*l).tail) (*l).tail = last;
+    }
+    (*l).length += length;
+    return length;
+}
+
+
+
+
+// :::::::::::::::::::::::::::::::::::::::::::::::::: COMPACTION :::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+const double DEFAULT_COMPACT_THRESHOLD = 0.5; // change to compact more or less often
+
+/**
+ * @brief Measures how scattered the nodes of a linked list are in memory
+ * @details A hop is scattered when the next node is not the one right after the node in memory,
+ * so walking the list can't use the cache lines and the pages already loaded.
+ * Time complexity: O(n), n = number of nodes in the list
+ * @param head Pointer to the head of the linked list
+ * @return double Fraction of scattered hops, from 0 (contiguous in traversal order) to 1.
+ * 0 for lists with less than 2 nodes
+ */
+double list_fragmentation(node* head){
+    if (!head || !(*head).next) return 0;
+
+    unsigned int hops = 0, scattered = 0;
+    for (node* temp = head; (*temp).next; temp = (*temp).next){
+        hops++;
+        scattered += (*temp).next != temp + 1;
+    }
+    return (double)scattered / hops;
+}
+
+
+/**
+ * @brief Copies a linked list of known length into consecutive nodes
+ * @details Helper of compact_list and linked_list_compact: the nodes are taken from one slab of dst
+ * (arena_reserve_nodes), each old node is released right after it is copied, so the list is walked once.
+ * Time complexity: O(n), n = number of nodes in the list
+ * @warning The old nodes are released: pointers to them are no longer valid
+ * @param dst Pointer to the arena of the new nodes
+ * @param src Pointer to the arena of the old nodes, NULL if they were allocated with malloc
+ * @param head Pointer to the head of the linked list
+ * @param length Number of nodes in the list
+ * @return node* Pointer to the head of the compacted list
+ */
+node* compact_nodes(arena* dst, arena* src, node* head, unsigned int length){
+    if (!dst || !head || length == 0) return head;
+
+    node* first = arena_reserve_nodes(dst, length);
+    node* temp = head;
+    for (unsigned int i = 0; i < length; i++){
+        node* next = (*temp).next;
+        first[i].value1 = (*temp).value1;
+        first[i].next = &first[i + 1];
+        if (src) arena_free_node(src, temp);
+        else {
+            free(temp); // deallocate memory
+            INSTRUMENT_FREES(1);
+        }
+        temp = next;
+    }
+    first[length - 1].next = NULL;
+    return first;
+}
+
+/**
+ * @brief Copies a linked list into one contiguous block in traversal order
+ * @details Counts the nodes, then copies them with compact_nodes:
+ * after it each hop goes to the next node in memory, as in a list created with arena_create_list.
+ * Time complexity: O(n), n = number of nodes in the list
+ * @warning The old nodes are released: pointers to them are no longer valid.
+ * The new nodes belong to dst and must not be freed with free or clear_list
+ * @param dst Pointer to the arena of the new nodes
+ * @param src Pointer to the arena of the old nodes, NULL if they were allocated with malloc
+ * @param head Pointer to the head of the linked list
+ * @return node* Pointer to the head of the compacted list
+ */
+node* compact_list(arena* dst, arena* src, node* head){
+    return compact_nodes(dst, src, head, (unsigned int)list_length(head));
+}
+
+
+/**
+ * @brief Compacts a linked list if its nodes are scattered
+ * @details Measures list_fragmentation and compacts the list with compact_nodes
+ * when it is at least the threshold (a threshold <= 0 always compacts, without measuring).
+ * Time complexity: O(n), n = number of nodes in the list
+ * @warning If the list is compacted the old nodes are released: pointers to them are no longer valid.
+ * The new nodes belong to dst
+ * @param l Pointer to the linked list
+ * @param dst Pointer to the arena of the new nodes
+ * @param src Pointer to the arena of the old nodes, NULL if they were allocated with malloc
+ * @param threshold Fraction of scattered hops that triggers the compaction (DEFAULT_COMPACT_THRESHOLD)
+ * @return int 1 if the list is compacted, 0 otherwise
+ */
+int linked_list_compact(linked_list* l, arena* dst, arena* src, double threshold){
+    if (!l || !dst || !(*l).head) return 0;
+    if (threshold > 0 && list_fragmentation((*l).head) < threshold) return 0;
+
+    (*l).head = compact_nodes(dst, src, (*l).head, (*l).length);
+    (*l).tail = (*l).head + ((*l).length - 1);
+    return 1;
+}
+
+
+
+
+// :::::::::::::::::::::::::::::::::::::::::::::::::: MAP_REDUCE :::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+/**
+ * @brief Splits a linked list into k segments of nearly equal length
+ * @details One walk: the lengths are known from the length of the list (the first length % k segments
+ * have one more node), and each segment is cut when its last node is reached. The list becomes empty.
+ * Time complexity: O(n), n = number of nodes in the list
+ * @param l Pointer to the linked list
+ * @param k Number of segments
+ * @param segments Array of at least k lists, written with the segments in the order of the list
+ * @return unsigned int Number of segments written (k, or the length of the list if it is shorter)
+ */
+unsigned int linked_list_split_k(linked_list* l, unsigned int k, linked_list segments[]){
+    if (!l || !segments || k == 0 || !(*l).head) return 0;
+    if (k > (*l).length) k = (*l).length;
+
+    node* rest = (*l).head;
+    for (unsigned int s = 0; s < k; s++){
+        unsigned int size = (*l).length / k + (s < (*l).length % k);
+        node* last = rest;
+        for (unsigned int i = 1; i < size; i++) last = (*last).next;
+        segments[s].head = rest;
+        segments[s].tail = last;
+        segments[s].length = size;
+        rest = (*last).next;
+        (*last).next = NULL;
+    }
+    (*l).head = (*l).tail = NULL;
+    (*l).length = 0;
+    return k;
+}
+
+
+/**
+ * @brief Joins segments back into one linked list
+ * @details Links the tail of each segment to the head of the next one (linked_list_concatenate),
+ * the segments become empty.
+ * Time complexity: O(k), k = number of segments
+ * @param l Pointer to the linked list, the segments are appended to it
+ * @param segments Array of the segments
+ * @param count Number of segments
+ * @return void Doesn't return a value
+ */
+void linked_list_stitch(linked_list* l, linked_list segments[], unsigned int count){
+    if (!l || !segments) return;
+
+    for (unsigned int s = 0; s < count; s++) linked_list_concatenate(l, &segments[s]);
+}
+
+
+/**
+ * @struct segment_task
+ * @brief Represent the work of one thread of segments_map_reduce
+ * @details It has the segment, the function to run on it, the partial result it writes and the user argument.
+ * Time complexity: O(1)
+ */
+typedef struct{
+    linked_list* segment;
+    void (*map)(linked_list*, void*, void*);
+    void* partial;
+    void* arg;
+} segment_task;
+
+
+/**
+ * @brief Thread function running the map function on one segment
+ * @details Time complexity: as the map function
+ * @param arg Pointer to the segment_task
+ * @return void* NULL
+ */
+void* map_segment_worker(void* arg){
+    segment_task* task = (segment_task*)arg;
+    (*task).map((*task).segment, (*task).partial, (*task).arg);
+    return NULL;
+}
+
+
+/**
+ * @brief Runs a function on each segment concurrently and combines the results
+ * @details Each segment runs on its own thread (run_tasks) with its own partial result,
+ * a copy of the initial value of result; more than MAX_SORT_THREADS segments run in waves of MAX_SORT_THREADS threads.
+ * Then the partial results of every segment are combined into result in the order of the segments,
+ * so combine only needs to be associative.
+ * The segments can be kept split between calls, so the walk of linked_list_split_k is paid once.
+ * Time complexity: O(n / k + k), n = number of nodes, k = number of segments
+ * @warning If memory allocation fails prints an error and exit program
+ * @param segments Array of the segments (from linked_list_split_k)
+ * @param count Number of segments
+ * @param map Function writing the result of a segment into its partial result (it also gets arg),
+ * it may change the values of the segment
+ * @param combine Function adding a partial result to the total (it also gets arg), NULL if there is no result
+ * @param result Pointer to the result: the identity of combine (0 for a sum, ...) before, the total after
+ * @param result_size Size of the result in bytes
+ * @param arg Argument passed to map and combine
+ * @return void Doesn't return a value
+ */
+void segments_map_reduce(linked_list segments[], unsigned int count, void (*map)(linked_list*, void*, void*),
+                         void (*combine)(void*, const void*, void*), void* result, size_t result_size, void* arg){
+    if (!segments || !map || count == 0) return;
+
+    char* partials = NULL;
+    if (combine && result && result_size){
+        partials = (char*)malloc(count * result_size);
+        if (!partials) {
+            printf("Memory allocation failed\n");
+            exit(EXIT_FAILURE); // critical error
+        }
+        for (unsigned int s = 0; s < count; s++) memcpy(partials + s * result_size, result, result_size);
+    }
+
+    segment_task tasks[MAX_SORT_THREADS];
+    for (unsigned int first = 0; first < count; first += MAX_SORT_THREADS){
+        unsigned int wave = count - first < MAX_SORT_THREADS ? count - first : MAX_SORT_THREADS;
+        for (unsigned int t = 0; t < wave; t++){
+            unsigned int s = first + t;
+            tasks[t].segment = &segments[s];
+            tasks[t].map = map;
+            tasks[t].partial = partials ? partials + s * result_size : NULL;
+            tasks[t].arg = arg;
+        }
+        run_tasks(map_segment_worker, tasks, sizeof(segment_task), wave);
+    }
+
+    if (partials)
+        for (unsigned int s = 0; s < count; s++) combine(result, partials + s * result_size, arg);
+    free(partials);
+}
+
+
+/**
+ * @brief Runs a function on a linked list with several threads and combines the results
+ * @details Splits the list into one segment for each thread (linked_list_split_k),
+ * runs segments_map_reduce, then stitches the segments back (linked_list_stitch): the list keeps its nodes and order.
+ * Lists shorter than threads * MIN_SEGMENT_NODES nodes are run as one segment on the calling thread.
+ * Time complexity: O(n) for the split, plus O(n / t) for the map, n = number of nodes in the list, t = threads
+ * @warning If memory allocation fails prints an error and exit program
+ * @param l Pointer to the linked list
+ * @param threads Number of threads (at most MAX_SORT_THREADS)
+ * @param map Function writing the result of a segment into its partial result (see segments_map_reduce)
+ * @param combine Function adding a partial result to the total, NULL if there is no result
+ * @param result Pointer to the result: the identity of combine before, the total after
+ * @param result_size Size of the result in bytes
+ * @param arg Argument passed to map and combine
+ * @return void Doesn't return a value
+ */
+void linked_list_map_reduce(linked_list* l, unsigned int threads, void (*map)(linked_list*, void*, void*),
+                            void (*combine)(void*, const void*, void*), void* result, size_t result_size, void* arg){
+    if (!l || !map || !(*l).head) return;
+    if (threads > MAX_SORT_THREADS) threads = MAX_SORT_THREADS;
+    if (threads == 0 || (*l).length < threads * MIN_SEGMENT_NODES) threads = 1;
+
+    linked_list segments[MAX_SORT_THREADS];
+    unsigned int count = threads > 1 ? linked_list_split_k(l, threads, segments) : 1;
+    if (threads == 1){
+        segments[0] = *l;
+        (*l).head = (*l).tail = NULL;
+        (*l).length = 0;
+    }
+    segments_map_reduce(segments, count, map, combine, result, result_size, arg);
+    linked_list_stitch(l, segments, count);
+}
+
+
+
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::: SET_OPERATIONS ::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+/**
+ * @brief Removes the repeated values of a sorted linked list
+ * @details One walk keeping the first node of each run of equal values,
+ * the other nodes are freed (released to the arena if there is one).
+ * Time complexity: O(n), n = number of nodes in the list
+ * @param l Pointer to the sorted linked list
+ * @param a Pointer to the arena of the nodes, NULL if they were allocated with malloc
+ * @return unsigned int Number of removed nodes
+ */
+unsigned int linked_list_dedupe(linked_list* l, arena* a){
+    if (!l || !(*l).head) return 0;
+
+    unsigned int removed = 0;
+    node* last = (*l).head;
+    for (node* temp = (*last).next; temp; ){
+        node* next = (*temp).next;
+        if ((*temp).value1 == (*last).value1){
+            if (a) arena_free_node(a, temp);
+            else {
+                free(temp); // deallocate memory
+                INSTRUMENT_FREES(1);
+            }
+            removed++;
+        } else {
+            (*last).next = temp;
+            last = temp;
+        }
+        temp = next;
+    }
+    (*last).next = NULL;
+    (*l).tail = last;
+    (*l).length -= removed;
+    return removed;
+}
+
+
+/**
+ * @brief Merges two sorted linked lists
+ * @details The nodes of l2 are relinked into l1 with merge_runs (stable: for equal values the nodes of l1 come first),
+ * the tail is the tail with the larger value. l2 becomes empty.
+ * Time complexity: O(n + m), n and m = number of nodes in the lists
+ * @param l1 Pointer to the first sorted linked list, it gets the merged list
+ * @param l2 Pointer to the second sorted linked list
+ * @return void Doesn't return a value
+ */
+void linked_list_merge(linked_list* l1, linked_list* l2){
+    if (!l1 || !l2 || l1 == l2 || !(*l2).head) return;
+
+    if (!(*l1).head || (*(*l2).tail).value1 >= (*(*l1).tail).value1) (*l1).tail = (*l2).tail;
+    (*l1).head = merge_runs((*l1).head, (*l2).head);
+    (*l1).length += (*l2).length;
+    (*l2).head = (*l2).tail = NULL;
+    (*l2).length = 0;
+}
+
+
+/**
+ * @brief Union of two sorted linked lists
+ * @details One walk merging the nodes of l2 into l1 and keeping one node for each value,
+ * the other nodes are freed (released to the arena if there is one). l2 becomes empty.
+ * Time complexity: O(n + m), n and m = number of nodes in the lists
+ * @param l1 Pointer to the first sorted linked list, it gets the union
+ * @param l2 Pointer to the second sorted linked list
+ * @param a Pointer to the arena of the nodes, NULL if they were allocated with malloc
+ * @return unsigned int Number of removed nodes
+ */
+unsigned int linked_list_union(linked_list* l1, linked_list* l2, arena* a){
+    if (!l1 || !l2 || l1 == l2) return l1 == l2 ? linked_list_dedupe(l1, a) : 0;
+
+    node merged; // placeholder before the first node
+    node* last = &merged;
+    node* head1 = (*l1).head;
+    node* head2 = (*l2).head;
+    unsigned int removed = 0;
+    while (head1 || head2){
+        node* n;
+        if (!head2 || (head1 && (*head1).value1 <= (*head2).value1)){
+            n = head1;
+            head1 = (*head1).next;
+        } else {
+            n = head2;
+            head2 = (*head2).next;
+        }
+        if (last != &merged && (*last).value1 == (*n).value1){
+            if (a) arena_free_node(a, n);
+            else {
+                free(n); // deallocate memory
+                INSTRUMENT_FREES(1);
+            }
+            removed++;
+        } else {
+            (*last).next = n;
+            last = n;
+        }
+    }
+    (*last).next = NULL;
+    (*l1).head = merged.next;
+    (*l1).tail = last == &merged ? NULL : last;
+    (*l1).length += (*l2).length - removed;
+    (*l2).head = (*l2).tail = NULL;
+    (*l2).length = 0;
+    return removed;
+}
+
+
+/**
+ * @brief Intersection of two sorted linked lists
+ * @details One walk of l1 with a pointer advancing in l2: l1 keeps one node for each value that is also in l2,
+ * the other nodes are freed (released to the arena if there is one). l2 is not changed.
+ * Time complexity: O(n + m), n and m = number of nodes in the lists
+ * @param l1 Pointer to the first sorted linked list, it gets the intersection
+ * @param l2 Pointer to the second sorted linked list
+ * @param a Pointer to the arena of the nodes of l1, NULL if they were allocated with malloc
+ * @return unsigned int Number of removed nodes
+ */
+unsigned int linked_list_intersection(linked_list* l1, linked_list* l2, arena* a){
+    if (!l1 || !l2 || l1 == l2) return l1 == l2 ? linked_list_dedupe(l1, a) : 0;
+
+    node kept; // placeholder before the first node
+    node* last = &kept;
+    node* other = (*l2).head;
+    unsigned int removed = 0;
+    for (node* temp = (*l1).head; temp; ){
+        node* next = (*temp).next;
+        while (other && (*other).value1 < (*temp).value1) other = (*other).next;
+        if (other && (*other).value1 == (*temp).value1 && (last == &kept || (*last).value1 != (*temp).value1)){
+            (*last).next = temp;
+            last = temp;
+        } else {
+            if (a) arena_free_node(a, temp);
+            else {
+                free(temp); // deallocate memory
+                INSTRUMENT_FREES(1);
+            }
+            removed++;
+        }
+        temp = next;
+    }
+    (*last).next = NULL;
+    (*l1).head = kept.next;
+    (*l1).tail = last == &kept ? NULL : last;
+    (*l1).length -= removed;
+    return removed;
+}
+
+
+/**
+ * @brief Difference of two sorted linked lists
+ * @details One walk of l1 with a pointer advancing in l2: l1 keeps one node for each value that is not in l2,
+ * the other nodes are freed (released to the arena if there is one). l2 is not changed.
+ * Time complexity: O(n + m), n and m = number of nodes in the lists
+ * @param l1 Pointer to the first sorted linked list, it gets the difference
+ * @param l2 Pointer to the second sorted linked list
+ * @param a Pointer to the arena of the nodes of l1, NULL if they were allocated with malloc
+ * @return unsigned int Number of removed nodes
+ */
+unsigned int linked_list_difference(linked_list* l1, linked_list* l2, arena* a){
+    if (!l1 || !l2) return 0;
+    if (l1 == l2){
+        unsigned int removed = (*l1).length;
+        if (a) arena_clear_list(a, (*l1).head);
+        else linked_list_clear(l1);
+        (*l1).head = (*l1).tail = NULL;
+        (*l1).length = 0;
+        return removed;
+    }
+
+    node kept; // placeholder before the first node
+    node* last = &kept;
+    node* other = (*l2).head;
+    unsigned int removed = 0;
+    for (node* temp = (*l1).head; temp; ){
+        node* next = (*temp).next;
+        while (other && (*other).value1 < (*temp).value1) other = (*other).next;
+        if (!(other && (*other).value1 == (*temp).value1) && (last == &kept || (*last).value1 != (*temp).value1)){
+            (*last).next = temp;
+            last = temp;
+        } else {
+            if (a) arena_free_node(a, temp);
+            else {
+                free(temp); // deallocate memory
+                INSTRUMENT_FREES(1);
+            }
+            removed++;
+        }
+        temp = next;
+    }
+    (*last).next = NULL;
+    (*l1).head = kept.next;
+    (*l1).tail = last == &kept ? NULL : last;
+    (*l1).length -= removed;
+    return removed;
+}
+
+
+
+
+// :::::::::::::::::::::::::::::::::::::::::::::::::: BENCHMARKS :::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+/**
+ * @brief Nanoseconds for each element
+ * @details Time complexity: O(1)
+ * @param start Clock at the start of the measure
+ * @param n Number of elements processed
+ * @return double Nanoseconds for each element
+ */
+double ns_per_element(clock_t start, unsigned int n){
+    return (double)(clock() - start) / CLOCKS_PER_SEC * 1e9 / (n ? n : 1);
+}
+
+
+/**
+ * @brief Values 0, 1, ..., n-1
+ * @details Time complexity: O(n)
+ * @warning If memory allocation fails prints an error and exit program
+ * @param n Number of values
+ * @return int* Array of the values (to be freed by the caller)
+ */
+int* benchmark_values(unsigned int n){
+    int* values = (int*)malloc((n ? n : 1) * sizeof(int));
+    if (!values) {
+        printf("Memory allocation failed\n");
+        exit(EXIT_FAILURE); // critical error
+    }
+    for (unsigned int i = 0; i < n; i++) values[i] = (int)i;
+    return values;
+}
+
+
+/**
+ * @brief Compares the arena with malloc for creating and clearing lists
+ * @details Prints ns/node of create_list + clear_list (one malloc/free for each node),
+ * arena_create_list + clear_arena (one slab) and node by node arena_create_node with the free list.
+ * Time complexity: O(n)
+ * @param n Number of nodes of the lists
+ * @return void Doesn't return a value
+ */
+void benchmark_arena(unsigned int n){
+    int* values = benchmark_values(n);
+
+    clock_t start = clock();
+    node* head = create_list(values, n);
+    double malloc_create = ns_per_element(start, n);
+    start = clock();
+    clear_list(head);
+    double malloc_clear = ns_per_element(start, n);
+
+    start = clock();
+    arena* a = create_arena(0);
+    head = arena_create_list(a, values, n);
+    double arena_create = ns_per_element(start, n);
+    start = clock();
+    clear_arena(a);
+    double arena_clear = ns_per_element(start, n);
+
+    a = create_arena(0);
+    for (int round = 0; round < 2; round++){ // the second round reuses the free list
+        start = clock();
+        head = NULL;
+        for (unsigned int i = n; i > 0; i--) head = insertion_head_node(head, arena_create_node(a, values[i - 1]));
+        double node_create = ns_per_element(start, n);
+        start = clock();
+        arena_clear_list(a, head);
+        printf("arena nodes (%s): create %.2f ns/node, clear %.2f ns/node\n",
+               round ? "free list" : "new slabs", node_create, ns_per_element(start, n));
+    }
+    clear_arena(a);
+
+    printf("malloc: create %.2f ns/node, clear %.2f ns/node\n", malloc_create, malloc_clear);
+    printf("arena list: create %.2f ns/node, clear %.2f ns/node\n", arena_create, arena_clear);
+    free(values);
+}
+
+
+
+/**
+ * @brief Compares appending node by node with and without the tail pointer
+ * @details Prints ns/node of n calls to linked_list_insertion_end_node
+ * and of insertion_end_node (O(n^2), limited to 20000 nodes).
+ * Time complexity: O(n + 20000^2)
+ * @param n Number of nodes appended
+ * @return void Doesn't return a value
+ */
+void benchmark_append(unsigned int n){
+    clock_t start = clock();
+    linked_list l = {NULL, NULL, 0};
+    for (unsigned int i = 0; i < n; i++) linked_list_insertion_end_node(&l, create_node((int)i));
+    printf("linked_list append: %.2f ns/node (%u nodes)\n", ns_per_element(start, n), linked_list_length(&l));
+    linked_list_clear(&l);
+
+    unsigned int m = n < 20000 ? n : 20000;
+    start = clock();
+    node* head = NULL;
+    for (unsigned int i = 0; i < m; i++) head = insertion_end_node(head, create_node((int)i));
+    printf("insertion_end_node append: %.2f ns/node (%u nodes)\n", ns_per_element(start, m), m);
+    clear_list(head);
+}
+
+
+/**
+ * @brief Compares the fused aggregates with the separate functions
+ * @details Prints ns/node of min_list + max_list + list_length + count_frequents_in_list,
+ * of aggregate_list and of aggregate_values on the array of the same values.
+ * Time complexity: O(n * rounds)
+ * @param n Number of nodes of the list
+ * @param rounds Number of repetitions
+ * @return void Doesn't return a value
+ */
+void benchmark_aggregates(unsigned int n, int rounds){
+    int* values = benchmark_values(n);
+    node* head = create_list(values, n);
+    unsigned int total = n * (unsigned int)rounds;
+    long long sink = 0;
+
+    clock_t start = clock();
+    for (int r = 0; r < rounds; r++)
+        sink += min_list(head) + max_list(head) + list_length(head) + count_frequents_in_list(head, r);
+    double separate = ns_per_element(start, total);
+
+    start = clock();
+    for (int r = 0; r < rounds; r++){
+        aggregates a = aggregate_list(head, AGGREGATE_ALL, r);
+        sink += a.min + a.max + a.length + a.frequency;
+    }
+    double fused = ns_per_element(start, total);
+
+    start = clock();
+    for (int r = 0; r < rounds; r++){
+        aggregates a = aggregate_values(values, n, AGGREGATE_ALL, r);
+        sink += a.min + a.max + a.length + a.frequency;
+    }
+    double simd = ns_per_element(start, total);
+
+    printf("4 separate traversals: %.2f ns/node, aggregate_list: %.2f ns/node, aggregate_values: %.2f ns/value (checksum %lld)\n",
+           separate, fused, simd, sink);
+    clear_list(head);
+    free(values);
+}
+
+
+/**
+ * @brief Compares two integers for qsort
+ * @details Time complexity: O(1)
+ * @param a Pointer to the first integer
+ * @param b Pointer to the second integer
+ * @return int Negative, zero or positive if a is less, equal or greater than b
+ */
+int compare_values(const void* a, const void* b){
+    int x = *(const int*)a, y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+
+/**
+ * @brief Times sort_list on sorted, reversed, random and many duplicates inputs
+ * @details Prints ns/node of sort_list and of qsort on an array of the same values,
+ * and checks that the sorted list is ordered.
+ * Time complexity: O(n log n)
+ * @param n Number of nodes of the lists
+ * @return void Doesn't return a value
+ */
+void benchmark_sort(unsigned int n){
+    const char* inputs[] = {"sorted", "reversed", "random", "duplicates"};
+    int* values = benchmark_values(n);
+
+    for (int input = 0; input < 4; input++){
+        for (unsigned int i = 0; i < n; i++){
+            if (input == 0) values[i] = (int)i;
+            else if (input == 1) values[i] = (int)(n - i);
+            else if (input == 2) values[i] = rand();
+            else values[i] = rand() % 16;
+        }
+        node* head = create_list(values, n);
+
+        clock_t start = clock();
+        head = sort_list(head);
+        double list_time = ns_per_element(start, n);
+
+        start = clock();
+        qsort(values, n, sizeof(int), compare_values);
+        double array_time = ns_per_element(start, n);
+
+        int ordered = 1;
+        for (node* temp = head; temp && (*temp).next; temp = (*temp).next)
+            if ((*temp).value1 > (*(*temp).next).value1) ordered = 0;
+        printf("sort %s: sort_list %.2f ns/node, qsort %.2f ns/value%s\n",
+               inputs[input], list_time, array_time, ordered ? "" : " (NOT SORTED)");
+        clear_list(head);
+    }
+    free(values);
+}
+
+
+/**
+ * @brief Wall clock time
+ * @details For the benchmarks with threads, where clock() adds the time of all the threads.
+ * Time complexity: O(1)
+ * @return double Seconds from an arbitrary point
+ */
+double wall_seconds(){
+    struct timespec t;
+    timespec_get(&t, TIME_UTC);
+    return (double)t.tv_sec + (double)t.tv_nsec * 1e-9;
+}
+
+
+/**
+ * @brief Times sort_list_parallel from 1 to max_threads threads
+ * @details Prints the wall time, ns/node and speedup over one thread,
+ * and checks that the result has the same values of sort_list.
+ * The lists are allocated in an arena, so every round starts from the same memory layout.
+ * Time complexity: O(max_threads * n log n)
+ * @param n Number of nodes of the list (random values)
+ * @param max_threads Largest number of threads
+ * @return void Doesn't return a value
+ */
+void benchmark_parallel_sort(unsigned int n, unsigned int max_threads){
+    int* values = benchmark_values(n);
+    for (unsigned int i = 0; i < n; i++) values[i] = rand();
+    arena* sorted = create_arena(0);
+    node* expected = sort_list(arena_create_list(sorted, values, n));
+    double single = 0;
+
+    for (unsigned int threads = 1; threads <= max_threads; threads++){
+        arena* a = create_arena(0); // nodes in order in memory at each round, unlike malloc after clear_list
+        node* head = arena_create_list(a, values, n);
+        double start = wall_seconds();
+        head = sort_list_parallel(head, threads);
+        double elapsed = wall_seconds() - start;
+        if (threads == 1) single = elapsed;
+
+        int same = 1;
+        for (node *got = head, *want = expected; got || want; got = (*got).next, want = (*want).next)
+            if (!got || !want || (*got).value1 != (*want).value1){
+                same = 0;
+                break;
+            }
+        printf("parallel sort %u threads: %.3f s, %.2f ns/node, speedup %.2f%s\n", threads, elapsed,
+               elapsed * 1e9 / (n ? n : 1), elapsed > 0 ? single / elapsed : 0, same ? "" : " (DIFFERENT FROM sort_list)");
+        clear_arena(a);
+    }
+    clear_arena(sorted);
+    free(values);
+}
+
+
+/**
+ * @brief Compares radix_sort_list, sort_list and sort_list_adaptive
+ * @details Prints ns/node for random values (positive and negative) on lists of 64 nodes to n nodes,
+ * and checks that the results are the same.
+ * The lists are allocated in an arena, so every sort starts from the same memory layout.
+ * Time complexity: O(n log n)
+ * @param n Largest number of nodes
+ * @return void Doesn't return a value
+ */
+void benchmark_radix_sort(unsigned int n){
+    if (n == 0) return;
+    int* values = benchmark_values(n);
+    for (unsigned int i = 0; i < n; i++) values[i] = rand() - RAND_MAX / 2;
+    node* (*sorts[])(node*) = {sort_list, radix_sort_list, sort_list_adaptive};
+
+    for (unsigned int length = n < 64 ? n : 64; ; length = length * 8 < n ? length * 8 : n){
+        unsigned int rounds = n / length; // about n nodes sorted by each function
+        double times[3];
+        int* reference = NULL;
+        int same = 1;
+        for (int s = 0; s < 3; s++){
+            arena* a = create_arena(0);
+            node** heads = (node**)malloc(rounds * sizeof(node*));
+            if (!heads) {
+                printf("Memory allocation failed\n");
+                exit(EXIT_FAILURE); // critical error
+            }
+            for (unsigned int r = 0; r < rounds; r++) heads[r] = arena_create_list(a, values, length);
+
+            clock_t start = clock();
+            for (unsigned int r = 0; r < rounds; r++) heads[r] = sorts[s](heads[r]);
+            times[s] = ns_per_element(start, rounds * length);
+
+            int* sorted = list_values(heads[0]);
+            if (s == 0) reference = sorted; // sort_list is the reference
+            else {
+                same = same && memcmp(reference, sorted, length * sizeof(int)) == 0;
+                free(sorted);
+            }
+            free(heads);
+            clear_arena(a);
+        }
+        printf("radix sort %u nodes: sort_list %.2f, radix_sort_list %.2f, sort_list_adaptive %.2f ns/node%s\n",
+               length, times[0], times[1], times[2], same ? "" : " (DIFFERENT RESULTS)");
+        free(reference);
+        if (length == n) break;
+    }
+    free(values);
+}
+
+
+/**
+ * @brief Compares a pass that changes the list with a cursor and with the functions that restart from the head
+ * @details On values 0, ..., n-1 removes the odd values and inserts a node after each multiple of 4,
+ * with the cursor (one walk) and with linked_list_remove_node and linked_list_insertion_after_node
+ * (each call walks from the head), checking that the results are the same. Prints ns/node.
+ * Time complexity: O(n^2)
+ * @param n Number of nodes of the lists
+ * @return void Doesn't return a value
+ */
+void benchmark_cursor(unsigned int n){
+    int* values = benchmark_values(n);
+    linked_list lists[2];
+    double times[2];
+
+    for (int k = 0; k < 2; k++){
+        lists[k] = linked_list_create(values, n);
+        clock_t start = clock();
+        if (k == 0){
+            cursor c = cursor_begin(&lists[0]);
+            while (!cursor_at_end(&c)){
+                int v = (*c.current).value1;
+                if (v % 2) free(cursor_remove(&c));
+                else {
+                    if (v % 4 == 0 && cursor_insertion_after(&c, create_node(-v))) cursor_next(&c); // skip the new node
+                    cursor_next(&c);
+                }
+            }
+        } else {
+            node* temp = lists[1].head;
+            while (temp){
+                node* next = (*temp).next;
+                int v = (*temp).value1;
+                if (v % 2) free(linked_list_remove_node(&lists[1], temp));
+                else if (v % 4 == 0) linked_list_insertion_after_node(&lists[1], temp, create_node(-v));
+                temp = next;
+            }
+        }
+        times[k] = ns_per_element(start, n);
+    }
+
+    int* first = linked_list_values(&lists[0]);
+    int* second = linked_list_values(&lists[1]);
+    int same = lists[0].length == lists[1].length && (!first || memcmp(first, second, lists[0].length * sizeof(int)) == 0);
+    printf("filter pass %u nodes: cursor %.2f ns/node, from the head %.2f ns/node%s\n",
+           n, times[0], times[1], same ? "" : " (DIFFERENT RESULTS)");
+    free(first);
+    free(second);
+    linked_list_clear(&lists[0]);
+    linked_list_clear(&lists[1]);
+    free(values);
+}
+
+
+/**
+ * @brief Predicate of benchmark_bulk: odd values
+ * @details Time complexity: O(1)
+ * @param value The value to check
+ * @param arg Not used
+ * @return int 1 if the value is odd, 0 otherwise
+ */
+int benchmark_is_odd(int value, void* arg){
+    (void)arg;
+    return value % 2 != 0;
+}
+
+/**
+ * @brief Function of benchmark_bulk: adds *(int*)arg to the value
+ * @details Time complexity: O(1)
+ * @param value The value to change
+ * @param arg Pointer to the int to add
+ * @return int The new value
+ */
+int benchmark_add(int value, void* arg){
+    return value + *(int*)arg;
+}
+
+/**
+ * @brief Compares the bulk operations with the single node functions that restart from the head
+ * @details On values i % 16 for i = 0, ..., n-1: removes every 0 with linked_list_remove_all_with_value
+ * and with linked_list_remove_node_with_value until it fails; inserts n values after the middle node
+ * with linked_list_splice_values (malloc and arena) and with linked_list_insertion_after_node one by one.
+ * Also prints the time of linked_list_filter and linked_list_map. Prints ns/node.
+ * Time complexity: O(n^2)
+ * @param n Number of nodes of the lists
+ * @return void Doesn't return a value
+ */
+void benchmark_bulk(unsigned int n){
+    if (n == 0) return;
+    int* values = benchmark_values(n);
+    for (unsigned int i = 0; i < n; i++) values[i] = (int)(i % 16);
+
+    linked_list l = linked_list_create(values, n);
+    clock_t start = clock();
+    unsigned int removed = linked_list_remove_all_with_value(&l, NULL, 0);
+    double bulk = ns_per_element(start, n);
+    linked_list_clear(&l);
+    l = linked_list_create(values, n);
+    start = clock();
+    node* n0;
+    while ((n0 = linked_list_remove_node_with_value(&l, 0))) free(n0);
+    printf("remove all %u of %u nodes: bulk %.2f ns/node, one by one %.2f ns/node\n",
+           removed, n, bulk, ns_per_element(start, n));
+    linked_list_clear(&l);
+
+    double times[3];
+    for (int k = 0; k < 3; k++){
+        arena* a = k == 1 ? create_arena(0) : NULL;
+        l = linked_list_create(values, n);
+        node* middle = l.head;
+        for (unsigned int i = 0; i < n / 2; i++) middle = (*middle).next;
+        start = clock();
+        if (k < 2) linked_list_splice_values(&l, a, middle, values, n);
+        else for (unsigned int i = n; i-- > 0; ) linked_list_insertion_after_node(&l, middle, create_node(values[i]));
+        times[k] = ns_per_element(start, n);
+        if (a){ // the spliced nodes belong to the arena: unlink them before clearing the list
+            node* after = middle;
+            for (unsigned int i = 0; i < n; i++) after = (*after).next;
+            (*middle).next = (*after).next;
+            if (l.tail == after) l.tail = middle;
+            l.length -= n;
+            clear_arena(a);
+        }
+        linked_list_clear(&l);
+    }
+    printf("splice %u values: malloc %.2f ns/node, arena %.2f ns/node, one by one %.2f ns/node\n",
+           n, times[0], times[1], times[2]);
+
+    l = linked_list_create(values, n);
+    int delta = 1;
+    start = clock();
+    linked_list odd = linked_list_filter(&l, benchmark_is_odd, NULL);
+    double filter = ns_per_element(start, n);
+    start = clock();
+    linked_list_map(&l, benchmark_add, &delta);
+    printf("filter %u nodes (%u moved): %.2f ns/node, map: %.2f ns/node\n",
+           n, odd.length, filter, ns_per_element(start, l.length));
+    linked_list_clear(&odd);
+    linked_list_clear(&l);
+    free(values);
+}
+
+
+/**
+ * @brief Measures the traversal of a linked list before and after the compaction
+ * @details Builds a list of random values in an arena (contiguous), sorts it (the nodes get scattered),
+ * then prints the fragmentation and the ns/node of a walk (sum of the values, best of 5)
+ * of the sorted list, the time of linked_list_compact and the same measures on the compacted list.
+ * Time complexity: O(n log n)
+ * @param n Number of nodes of the list
+ * @return void Doesn't return a value
+ */
+void benchmark_compaction(unsigned int n){
+    if (n == 0) return;
+    int* values = benchmark_values(n);
+    srand(12345);
+    for (unsigned int i = 0; i < n; i++) values[i] = rand();
+
+    arena* src = create_arena(0);
+    arena* dst = create_arena(0);
+    linked_list l = {arena_create_list(src, values, n), NULL, n};
+    linked_list_sort(&l);
+
+    long long sink = 0;
+    double walks[2], fragmentation[2], compaction = 0;
+    for (int k = 0; k < 2; k++){
+        if (k == 1){
+            clock_t start = clock();
+            linked_list_compact(&l, dst, src, DEFAULT_COMPACT_THRESHOLD);
+            compaction = ns_per_element(start, n);
+        }
+        fragmentation[k] = list_fragmentation(l.head);
+        walks[k] = 0;
+        for (int round = 0; round < 5; round++){
+            clock_t start = clock();
+            for (node* temp = l.head; temp; temp = (*temp).next) sink += (*temp).value1;
+            double walk = ns_per_element(start, n);
+            if (round == 0 || walk < walks[k]) walks[k] = walk;
+        }
+    }
+    printf("walk %u nodes: scattered %.2f ns/node (fragmentation %.2f), compacted %.2f ns/node (fragmentation %.2f), "
+           "compaction %.2f ns/node (checksum %lld)\n", n, walks[0], fragmentation[0], walks[1], fragmentation[1],
+           compaction, sink);
+    clear_arena(src);
+    clear_arena(dst);
+    free(values);
+}
+
+
+/**
+ * @struct benchmark_totals
+ * @brief Represent the result of the map/reduce benchmark: sum, min and max of the values
+ * Time complexity: O(1)
+ */
+typedef struct{
+    long long sum;
+    int min;
+    int max;
+} benchmark_totals;
+
+/**
+ * @brief Map function of benchmark_map_reduce: sum, min and max of a segment
+ * @details Time complexity: O(n), n = number of nodes in the segment
+ * @param segment Pointer to the segment
+ * @param partial Pointer to the benchmark_totals of the segment
+ * @param arg Not used
+ * @return void Doesn't return a value
+ */
+void benchmark_totals_map(linked_list* segment, void* partial, void* arg){
+    (void)arg;
+    benchmark_totals* t = (benchmark_totals*)partial;
+    for (node* temp = (*segment).head; temp; temp = (*temp).next){
+        (*t).sum += (*temp).value1;
+        if ((*temp).value1 < (*t).min) (*t).min = (*temp).value1;
+        if ((*temp).value1 > (*t).max) (*t).max = (*temp).value1;
+    }
+}
+
+/**
+ * @brief Combine function of benchmark_map_reduce
+ * @details Time complexity: O(1)
+ * @param total Pointer to the benchmark_totals of the list
+ * @param partial Pointer to the benchmark_totals of a segment
+ * @param arg Not used
+ * @return void Doesn't return a value
+ */
+void benchmark_totals_combine(void* total, const void* partial, void* arg){
+    (void)arg;
+    benchmark_totals* t = (benchmark_totals*)total;
+    const benchmark_totals* p = (const benchmark_totals*)partial;
+    (*t).sum += (*p).sum;
+    if ((*p).min < (*t).min) (*t).min = (*p).min;
+    if ((*p).max > (*t).max) (*t).max = (*p).max;
+}
+
+/**
+ * @brief Map function of benchmark_map_reduce: adds *(int*)arg to each value of a segment
+ * @details Time complexity: O(n), n = number of nodes in the segment
+ * @param segment Pointer to the segment
+ * @param partial Not used
+ * @param arg Pointer to the int to add
+ * @return void Doesn't return a value
+ */
+void benchmark_add_map(linked_list* segment, void* partial, void* arg){
+    (void)partial;
+    linked_list_map(segment, benchmark_add, arg);
+}
+
+/**
+ * @brief Compares the map/reduce with different numbers of threads
+ * @details On a list of n random values (allocated in an arena) prints the wall time (ns/node) of
+ * sum, min and max with linked_list_map_reduce (split, map, stitch) and with segments_map_reduce on segments
+ * split once, and of adding 1 to each value, for 1, 2, ..., max_threads threads,
+ * checking the totals against aggregate_list.
+ * Time complexity: O(n * max_threads)
+ * @param n Number of nodes of the list
+ * @param max_threads Largest number of threads
+ * @return void Doesn't return a value
+ */
+void benchmark_map_reduce(unsigned int n, unsigned int max_threads){
+    if (n == 0) return;
+    int* values = benchmark_values(n);
+    srand(12345);
+    for (unsigned int i = 0; i < n; i++) values[i] = rand() - RAND_MAX / 2;
+    arena* a = create_arena(0);
+    linked_list l = {arena_create_list(a, values, n), NULL, n};
+    l.tail = l.head + (n - 1);
+    aggregates expected = aggregate_list(l.head, AGGREGATE_MIN | AGGREGATE_MAX, 0);
+    long long expected_sum = 0;
+    for (unsigned int i = 0; i < n; i++) expected_sum += values[i];
+
+    for (unsigned int threads = 1; threads <= max_threads && threads <= MAX_SORT_THREADS; threads++){
+        benchmark_totals totals = {0, 2147483647, -2147483647 - 1};
+        double start = wall_seconds();
+        linked_list_map_reduce(&l, threads, benchmark_totals_map, benchmark_totals_combine, &totals, sizeof(totals), NULL);
+        double whole = wall_seconds() - start;
+        int same = totals.sum == expected_sum && totals.min == expected.min && totals.max == expected.max;
+
+        linked_list segments[MAX_SORT_THREADS];
+        unsigned int count = linked_list_split_k(&l, threads, segments);
+        benchmark_totals split_totals = {0, 2147483647, -2147483647 - 1};
+        start = wall_seconds();
+        segments_map_reduce(segments, count, benchmark_totals_map, benchmark_totals_combine,
+                            &split_totals, sizeof(split_totals), NULL);
+        double split = wall_seconds() - start;
+        int delta = 1;
+        start = wall_seconds();
+        segments_map_reduce(segments, count, benchmark_add_map, NULL, NULL, 0, &delta);
+        double transform = wall_seconds() - start;
+        delta = -1;
+        segments_map_reduce(segments, count, benchmark_add_map, NULL, NULL, 0, &delta);
+        linked_list_stitch(&l, segments, count);
+        same = same && split_totals.sum == expected_sum && l.length == n;
+
+        printf("map/reduce %u nodes, %u threads: totals %.2f ns/node (pre-split %.2f), add %.2f ns/node%s\n",
+               n, threads, whole * 1e9 / n, split * 1e9 / n, transform * 1e9 / n, same ? "" : " (DIFFERENT RESULTS)");
+    }
+    clear_arena(a);
+    free(values);
+}
+
+/**
+ * @brief Compares the set operations on sorted lists with searching each value
+ * @details On two sorted lists of n random values in [0, 2n) (allocated in an arena) prints the ns/node
+ * of linked_list_dedupe, linked_list_union, linked_list_intersection, linked_list_difference and linked_list_merge,
+ * and of an intersection with value_in_list for each node (on at most 20000 nodes, it is O(n^2)).
+ * Time complexity: O(n^2)
+ * @param n Number of nodes of each list
+ * @return void Doesn't return a value
+ */
+void benchmark_set_operations(unsigned int n){
+    if (n == 0) return;
+    int* values1 = benchmark_values(n);
+    int* values2 = benchmark_values(n);
+    srand(12345);
+    for (unsigned int i = 0; i < n; i++){
+        values1[i] = rand() % (2 * n);
+        values2[i] = rand() % (2 * n);
+    }
+    qsort(values1, n, sizeof(int), compare_values);
+    qsort(values2, n, sizeof(int), compare_values);
+
+    const char* names[] = {"dedupe", "union", "intersection", "difference", "merge"};
+    unsigned int removed[5] = {0};
+    double times[5];
+    for (int k = 0; k < 5; k++){
+        arena* a = create_arena(0);
+        linked_list l1 = {arena_create_list(a, values1, n), NULL, n};
+        linked_list l2 = {arena_create_list(a, values2, n), NULL, n};
+        l1.tail = l1.head + (n - 1);
+        l2.tail = l2.head + (n - 1);
+        clock_t start = clock();
+        switch (k){
+            case 0: removed[k] = linked_list_dedupe(&l1, a); break;
+            case 1: removed[k] = linked_list_union(&l1, &l2, a); break;
+            case 2: removed[k] = linked_list_intersection(&l1, &l2, a); break;
+            case 3: removed[k] = linked_list_difference(&l1, &l2, a); break;
+            default: linked_list_merge(&l1, &l2);
+        }
+        times[k] = ns_per_element(start, k == 0 ? n : 2 * n);
+        clear_arena(a);
+    }
+    for (int k = 0; k < 5; k++)
+        printf("%s of %u sorted nodes: %.2f ns/node (%u removed)\n", names[k], k == 0 ? n : 2 * n, times[k], removed[k]);
+
+    unsigned int m = n < 20000 ? n : 20000;
+    node* head1 = create_list(values1, m);
+    node* head2 = create_list(values2, m);
+    clock_t start = clock();
+    unsigned int kept = 0;
+    for (node* temp = head1; temp; temp = (*temp).next) kept += value_in_list(head2, (*temp).value1).node2 != NULL;
+    printf("intersection of %u nodes with value_in_list: %.2f ns/node (%u kept, duplicates included)\n",
+           2 * m, ns_per_element(start, 2 * m), kept);
+    clear_list(head1);
+    clear_list(head2);
+    free(values1);
+    free(values2);
+}
+
+
+
+/**
+ * @brief Calls the functions of the LIST section like a program changing a list, for the counters
+ * @details Appends n/10 values at the end, inserts after and before and removes nodes by value,
+ * searches values, then sorts and clears the list. The counters are reset at the start.
+ * Time complexity: O(n^2)
+ * @param n Number of nodes of the list
+ * @return void Doesn't return a value
+ */
+void instrument_workload(unsigned int n){
+    if (n < 2) return;
+    instrument_reset();
+    int* values = benchmark_values(n);
+    node* head = create_list(values, n);
+    long long sink = 0;
+
+    for (unsigned int i = 0; i < n / 10; i++) head = insertion_end_node(head, create_node((int)i));
+    for (unsigned int i = 0; i < n / 10; i++){
+        int v = 1 + (int)(((unsigned long long)i * 2654435761u) % (n - 1)); // not the head: insertion_before_node skips it
+        node* found = value_in_list(head, v).node2;
+        head = insertion_after_node(head, found, create_node(v));
+        head = insertion_before_node(head, found, create_node(v));
+        tuple removed = remove_node_with_value(head, v);
+        head = removed.node1;
+        free(removed.node2);
+        INSTRUMENT_FREES(1); // freed here, not by the library
+        sink += count_frequents_in_list(head, v);
+    }
+    head = sort_list(head);
+    sink += list_length(head) + max_list(head) + min_list(head);
+    clear_list(head);
+    free(values);
+    if (sink == 42) printf(" "); // uses the results
+}
+
+
+// :::::::::::::::::::::::::::::::::::::::::::::::::::::: TESTS ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+#ifndef LINKEDLIST_NO_MAIN // defined by the programs including this file
+/**
+ * @brief Tests the change of a node in the middle of a linked_list
+ * @details Changes the middle node of a list of 5 values with linked_list_change_node_value:
+ * the list must keep its 5 nodes (walked from the head) and its tail, with only the middle value changed.
+ * Time complexity: O(1)
+ * @return int 1 if the test passes, 0 otherwise
+ */
+int test_change_middle_node(){
+    int values[5] = {1, 2, 3, 4, 5};
+    linked_list l = linked_list_create(values, 5);
+    node* middle = (*(*l.head).next).next;
+    node* tail = l.tail;
+
+    int passed = linked_list_change_node_value(&l, middle, 30) == middle;
+    values[2] = 30;
+    unsigned int length = 0;
+    node* last = NULL;
+    for (node* temp = l.head; temp; temp = (*temp).next, length++){
+        passed = passed && length < 5 && (*temp).value1 == values[length];
+        last = temp;
+    }
+    passed = passed && length == 5 && linked_list_length(&l) == 5 && l.tail == tail && last == tail && !(*tail).next;
+    printf("change of a middle node: %s\n", passed ? "passed" : "FAILED");
+    linked_list_clear(&l);
+    return passed;
+}
+
+
+/**
+ * @brief Checks a linked_list against the expected values, used by the tests
+ * @details Walks the list from the head: the values must be the expected ones in order,
+ * the length must be the number of nodes and the tail must be the last node (NULL head and tail if empty).
+ * Time complexity: O(n), n = number of nodes in the list
+ * @param l Pointer to the linked list
+ * @param values Array of the expected values
+ * @param length Number of expected values
+ * @return int 1 if the list has the values, 0 otherwise
+ */
+int test_list_matches(linked_list* l, int values[], unsigned int length){
+    unsigned int i = 0;
+    node* last = NULL;
+    for (node* temp = (*l).head; temp; temp = (*temp).next, i++){
+        if (i >= length || (*temp).value1 != values[i]) return 0;
+        last = temp;
+    }
+    return i == length && (*l).length == length && (*l).tail == last && (!last || !(*last).next);
+}
+
+/**
+ * @brief Tests linked_list_remove_if and linked_list_remove_all_with_value
+ * @details With malloc: removes the odd values, then every 2 (head and tail included), then the last value.
+ * With an arena: removes every 2, then the odd values. Checks the values, the length and the tail after each one.
+ * Time complexity: O(1)
+ * @return int 1 if the test passes, 0 otherwise
+ */
+int test_remove_if(){
+    int values[10] = {2, 1, 3, 2, 5, 2, 7, 8, 9, 2};
+    int even[5] = {2, 2, 2, 8, 2};
+    int eight[1] = {8};
+    int without_2[6] = {1, 3, 5, 7, 8, 9};
+
+    linked_list l = linked_list_create(values, 10);
+    int passed = linked_list_remove_if(&l, NULL, benchmark_is_odd, NULL) == 5 && test_list_matches(&l, even, 5);
+    passed = passed && linked_list_remove_all_with_value(&l, NULL, 2) == 4 && test_list_matches(&l, eight, 1);
+    passed = passed && linked_list_remove_all_with_value(&l, NULL, 2) == 0 && test_list_matches(&l, eight, 1);
+    passed = passed && linked_list_remove_all_with_value(&l, NULL, 8) == 1 && test_list_matches(&l, NULL, 0);
+    linked_list_clear(&l);
+
+    arena* a = create_arena(0);
+    linked_list la = {arena_create_list(a, values, 10), NULL, 10};
+    la.tail = la.head + 9; // consecutive nodes
+    passed = passed && linked_list_remove_all_with_value(&la, a, 2) == 4 && test_list_matches(&la, without_2, 6);
+    passed = passed && linked_list_remove_if(&la, a, benchmark_is_odd, NULL) == 5 && test_list_matches(&la, eight, 1);
+    clear_arena(a);
+    printf("remove if: %s\n", passed ? "passed" : "FAILED");
+    return passed;
+}
+
+/**
+ * @brief Tests linked_list_filter and linked_list_map
+ * @details Moves the odd values of 1, ..., 8 to a new list, then adds 10 to the values of both lists:
+ * checks the values, the lengths and the tails of both lists. Filtering every value or none is checked too.
+ * Time complexity: O(1)
+ * @return int 1 if the test passes, 0 otherwise
+ */
+int test_filter_map(){
+    int values[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+    int odd[4] = {11, 13, 15, 17};
+    int even[4] = {12, 14, 16, 18};
+    int ten = 10;
+
+    linked_list l = linked_list_create(values, 8);
+    linked_list moved = linked_list_filter(&l, benchmark_is_odd, NULL);
+    linked_list_map(&l, benchmark_add, &ten);
+    linked_list_map(&moved, benchmark_add, &ten);
+    int passed = test_list_matches(&l, even, 4) && test_list_matches(&moved, odd, 4);
+
+    linked_list none = linked_list_filter(&l, benchmark_is_odd, NULL); // every value is even
+    passed = passed && test_list_matches(&none, NULL, 0) && test_list_matches(&l, even, 4);
+    linked_list all = linked_list_filter(&moved, benchmark_is_odd, NULL);
+    passed = passed && test_list_matches(&all, odd, 4) && test_list_matches(&moved, NULL, 0);
+    printf("filter and map: %s\n", passed ? "passed" : "FAILED");
+    linked_list_clear(&l);
+    linked_list_clear(&all);
+    return passed;
+}
+
+/**
+ * @brief Tests linked_list_splice_values
+ * @details With malloc: splices values into an empty list, at the head, after a middle node and after the tail.
+ * With an arena: splices after the tail and at the head. Checks the values, the length and the tail after each one.
+ * Time complexity: O(1)
+ * @return int 1 if the test passes, 0 otherwise
+ */
+int test_splice_values(){
+    int first[2] = {3, 4};
+    int head[2] = {1, 2};
+    int middle[2] = {10, 11};
+    int end[1] = {5};
+    int step2[4] = {1, 2, 3, 4};
+    int step3[6] = {1, 2, 10, 11, 3, 4};
+    int step4[7] = {1, 2, 10, 11, 3, 4, 5};
+
+    linked_list l = {NULL, NULL, 0};
+    int passed = linked_list_splice_values(&l, NULL, NULL, first, 2) == 2 && test_list_matches(&l, first, 2);
+    passed = passed && linked_list_splice_values(&l, NULL, NULL, head, 2) == 2 && test_list_matches(&l, step2, 4);
+    passed = passed && linked_list_splice_values(&l, NULL, (*l.head).next, middle, 2) == 2 && test_list_matches(&l, step3, 6);
+    passed = passed && linked_list_splice_values(&l, NULL, l.tail, end, 1) == 1 && test_list_matches(&l, step4, 7);
+    passed = passed && linked_list_splice_values(&l, NULL, l.tail, end, 0) == 0 && test_list_matches(&l, step4, 7);
+    linked_list_clear(&l);
+
+    arena* a = create_arena(0);
+    linked_list la = {arena_create_list(a, first, 2), NULL, 2};
+    la.tail = la.head + 1; // consecutive nodes
+    passed = passed && linked_list_splice_values(&la, a, la.tail, end, 1) == 1;
+    passed = passed && linked_list_splice_values(&la, a, NULL, head, 2) == 2;
+    int arena_values[5] = {1, 2, 3, 4, 5};
+    passed = passed && test_list_matches(&la, arena_values, 5);
+    clear_arena(a);
+    printf("splice of values: %s\n", passed ? "passed" : "FAILED");
+    return passed;
+}
+
+
+/**
+ * @brief Entry point of the program, used for testing
+ * @details Runs the tests. With the argument "instrument" runs instrument_workload and prints the counters
+ * (the optional second argument is the number of nodes, default 10000).
+ * With the argument "benchmark" runs the benchmarks
+ * (the optional second argument is the number of nodes, default 1000000,
+ * the third the largest number of threads, default 4; the cursor and bulk benchmarks use at most 20000 nodes).
+ * @return 0 if the tests pass, 1 otherwise
+ */
+int main(int argc, char* argv[]){
+    int passed = test_change_middle_node();
+    passed = test_remove_if() && passed;
+    passed = test_filter_map() && passed;
+    passed = test_splice_values() && passed;
+    if (argc > 1 && strcmp(argv[1], "instrument") == 0){
+        unsigned int n = argc > 2 ? (unsigned int)strtoul(argv[2], NULL, 10) : 10000;
+        instrument_workload(n);
+        instrument_counters counters = instrument_snapshot();
+        instrument_dump(stdout, &counters);
+    }
+    if (argc > 1 && strcmp(argv[1], "benchmark") == 0){
+        unsigned int n = argc > 2 ? (unsigned int)strtoul(argv[2], NULL, 10) : 1000000;
+        benchmark_arena(n);
+        benchmark_append(n);
+        benchmark_aggregates(n, 10);
+        benchmark_sort(n);
+        benchmark_parallel_sort(n, argc > 3 ? (unsigned int)strtoul(argv[3], NULL, 10) : 4);
+        benchmark_radix_sort(n);
+        benchmark_compaction(n);
+        benchmark_map_reduce(n, argc > 3 ? (unsigned int)strtoul(argv[3], NULL, 10) : 4);
+        benchmark_set_operations(n);
+        benchmark_cursor(n < 20000 ? n : 20000); // the pass from the head is O(n^2)
+        benchmark_bulk(n < 20000 ? n : 20000); // so are the single node functions
+    }
+    return passed ? 0 : 1;
 
-    /* compiling: gcc linkedList.c -o linkedList
-    executing: linkedList */
+    /* compiling: gcc linkedList.c -o linkedList -lpthread
+    executing: linkedList [benchmark [nodes [threads]]]
+    with the counters: gcc -DLINKEDLIST_INSTRUMENT linkedList.c -o linkedList -lpthread
+    executing: linkedList instrument [nodes] */
 }
+#endif
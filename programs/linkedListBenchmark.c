@@ -0,0 +1,774 @@
+// ::::::::::::::::::::::::::::::::::::::::::::::::: LIBRARIES :::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+/**
+ * @file linkedListBenchmark.c
+ * @author Lorenzo Mercuri
+ * @brief Benchmark of every function of the LIST section of linkedList.c
+ * @details Times each function on lists of 10, 100, ... nodes, with the nodes allocated in three layouts
+ * (sequential, shuffled and fragmented) and four kinds of data (sorted, reversed, random and duplicates).
+ * Prints one record for each measure, as CSV or JSON, with ns/op, ns/element and,
+ * on Linux when perf_event is available, the cache misses and branch misses for each operation.
+ * (perf_event_open: https://man7.org/linux/man-pages/man2/perf_event_open.2.html).
+ * linkedList.c is included for the functions to measure
+ */
+#if !defined(_GNU_SOURCE)
+#define _GNU_SOURCE // syscall in unistd.h, also under -std=c11
+#endif
+#define LINKEDLIST_NO_MAIN
+#include "linkedList.c"
+#include <stdint.h>
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#endif
+
+
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::: COUNTERS ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+/* LIST OF FUNCTIONS:
+    1) bench_open_counter
+    creations:
+        2) bench_timer_create
+        3) bench_timer_close
+    4) bench_timer_reset
+    5) bench_timer_start
+    6) bench_timer_stop
+    7) bench_timer_read */
+
+
+#define BENCH_COUNTERS 2 // cache misses, branch misses
+
+/**
+ * @struct bench_timer
+ * @brief Represent the measure of the timed parts of an operation
+ * @details It has the seconds measured, the file descriptors of the hardware counters (-1 if not available),
+ * the counts read at the end and the start of the running part.
+ * Time complexity: O(1)
+ */
+typedef struct{
+    double seconds;
+    int fds[BENCH_COUNTERS];
+    long long counts[BENCH_COUNTERS]; // -1 if not available
+    double start;
+} bench_timer;
+
+
+/**
+ * @brief Opens a hardware counter of the calling thread
+ * @details The counter starts disabled and counts only user space.
+ * Time complexity: O(1)
+ * @param config The counter (PERF_COUNT_HW_*)
+ * @return int The file descriptor of the counter, -1 if it can't be opened (or not on Linux)
+ */
+int bench_open_counter(unsigned long long config){
+#if defined(__linux__)
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = config;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return (int)syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+#else
+    (void)config;
+    return -1;
+#endif
+}
+
+/**
+ * @brief Create a timer with the hardware counters that can be opened
+ * @details Time complexity: O(1)
+ * @return bench_timer The new timer
+ */
+bench_timer bench_timer_create(){
+    bench_timer t;
+    memset(&t, 0, sizeof(t));
+#if defined(__linux__)
+    t.fds[0] = bench_open_counter(PERF_COUNT_HW_CACHE_MISSES);
+    t.fds[1] = bench_open_counter(PERF_COUNT_HW_BRANCH_MISSES);
+#else
+    t.fds[0] = t.fds[1] = -1;
+#endif
+    return t;
+}
+
+/**
+ * @brief Closes the hardware counters of a timer
+ * @details Time complexity: O(1)
+ * @param t Pointer to the timer
+ * @return void Doesn't return a value
+ */
+void bench_timer_close(bench_timer* t){
+#if !defined(_WIN32)
+    for (int i = 0; i < BENCH_COUNTERS; i++)
+        if ((*t).fds[i] >= 0) close((*t).fds[i]);
+#endif
+    for (int i = 0; i < BENCH_COUNTERS; i++) (*t).fds[i] = -1;
+}
+
+
+/**
+ * @brief Sets the seconds and the counters of a timer to 0
+ * @details Time complexity: O(1)
+ * @param t Pointer to the timer
+ * @return void Doesn't return a value
+ */
+void bench_timer_reset(bench_timer* t){
+    (*t).seconds = 0;
+#if defined(__linux__)
+    for (int i = 0; i < BENCH_COUNTERS; i++)
+        if ((*t).fds[i] >= 0) ioctl((*t).fds[i], PERF_EVENT_IOC_RESET, 0);
+#endif
+}
+
+/**
+ * @brief Starts a timed part
+ * @details Time complexity: O(1)
+ * @param t Pointer to the timer
+ * @return void Doesn't return a value
+ */
+void bench_timer_start(bench_timer* t){
+#if defined(__linux__)
+    for (int i = 0; i < BENCH_COUNTERS; i++)
+        if ((*t).fds[i] >= 0) ioctl((*t).fds[i], PERF_EVENT_IOC_ENABLE, 0);
+#endif
+    (*t).start = wall_seconds();
+}
+
+/**
+ * @brief Ends a timed part
+ * @details Time complexity: O(1)
+ * @param t Pointer to the timer
+ * @return void Doesn't return a value
+ */
+void bench_timer_stop(bench_timer* t){
+    (*t).seconds += wall_seconds() - (*t).start;
+#if defined(__linux__)
+    for (int i = 0; i < BENCH_COUNTERS; i++)
+        if ((*t).fds[i] >= 0) ioctl((*t).fds[i], PERF_EVENT_IOC_DISABLE, 0);
+#endif
+}
+
+/**
+ * @brief Reads the counters of a timer
+ * @details Time complexity: O(1)
+ * @param t Pointer to the timer
+ * @return void Doesn't return a value
+ */
+void bench_timer_read(bench_timer* t){
+    for (int i = 0; i < BENCH_COUNTERS; i++){
+        (*t).counts[i] = -1;
+#if !defined(_WIN32)
+        long long count;
+        if ((*t).fds[i] >= 0 && read((*t).fds[i], &count, sizeof(count)) == (ssize_t)sizeof(count)) (*t).counts[i] = count;
+#endif
+    }
+}
+
+
+
+
+// :::::::::::::::::::::::::::::::::::::::::::::::::::: LISTS ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+/* LIST OF FUNCTIONS:
+    1) bench_random
+    2) bench_relink
+    3) bench_build
+    4) bench_free */
+
+
+#define BENCH_LAYOUTS 3
+#define BENCH_DATA 4
+const char* BENCH_LAYOUT_NAMES[BENCH_LAYOUTS] = {"sequential", "shuffled", "fragmented"};
+const char* BENCH_DATA_NAMES[BENCH_DATA] = {"sorted", "reversed", "random", "duplicates"};
+
+/**
+ * @struct bench_list
+ * @brief Represent the list under measure
+ * @details It has the nodes in the order of the list, their values, the head and the nodes used as targets:
+ * the middle node, the node before it and the tail.
+ * Every node is allocated with malloc, so each function of the LIST section can be used on it.
+ * Time complexity: O(1)
+ */
+typedef struct{
+    node** nodes;
+    int* values;
+    unsigned int n;
+    node* head;
+    node* middle;
+    node* before_middle; // NULL if the middle node is the head
+    node* tail;
+} bench_list;
+
+
+/**
+ * @brief Pseudo random numbers for the benchmark
+ * @details xorshift64, the same sequence on every platform.
+ * Time complexity: O(1)
+ * @param state Pointer to the state (not 0)
+ * @return unsigned int The next number
+ */
+unsigned int bench_random(unsigned long long* state){
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+    return (unsigned int)(*state >> 32);
+}
+
+
+/**
+ * @brief Relinks the nodes of the list under measure in their order and gives them back their values
+ * @details Used after the functions that change the list.
+ * Time complexity: O(n), n = number of nodes in the list
+ * @param b Pointer to the list
+ * @return void Doesn't return a value
+ */
+void bench_relink(bench_list* b){
+    for (unsigned int i = 0; i < (*b).n; i++){
+        (*(*b).nodes[i]).value1 = (*b).values[i];
+        (*(*b).nodes[i]).next = i + 1 < (*b).n ? (*b).nodes[i + 1] : NULL;
+    }
+    (*b).head = (*b).nodes[0];
+}
+
+
+/**
+ * @brief Builds the list under measure
+ * @details Layouts: sequential (nodes allocated one after the other, in the order of the list),
+ * shuffled (allocated in the same way, linked in random order)
+ * and fragmented (a random block of 16 to 256 bytes allocated after each node and freed at the end,
+ * so the nodes are spread with holes between them).
+ * Data: sorted (0, 1, ...), reversed (n-1, n-2, ...), random and duplicates (random from 0 to 15).
+ * Time complexity: O(n)
+ * @warning If memory allocation fails prints an error and exit program
+ * @param n Number of nodes (at least 2)
+ * @param layout Index of the layout in BENCH_LAYOUT_NAMES
+ * @param data Index of the data in BENCH_DATA_NAMES
+ * @return bench_list The new list
+ */
+bench_list bench_build(unsigned int n, int layout, int data){
+    bench_list b;
+    b.n = n;
+    b.nodes = (node**)malloc(n * sizeof(node*));
+    b.values = (int*)malloc(n * sizeof(int));
+    void** holes = layout == 2 ? (void**)malloc(n * sizeof(void*)) : NULL;
+    if (!b.nodes || !b.values || (layout == 2 && !holes)) {
+        printf("Memory allocation failed\n");
+        exit(EXIT_FAILURE); // critical error
+    }
+
+    unsigned long long state = 0x9E3779B97F4A7C15ull + n;
+    for (unsigned int i = 0; i < n; i++){
+        if (data == 0) b.values[i] = (int)i;
+        else if (data == 1) b.values[i] = (int)(n - 1 - i);
+        else if (data == 2) b.values[i] = (int)(bench_random(&state) & 0x7FFFFFFF);
+        else b.values[i] = (int)(bench_random(&state) % 16);
+    }
+
+    for (unsigned int i = 0; i < n; i++){
+        b.nodes[i] = create_node(b.values[i]);
+        if (holes){
+            holes[i] = malloc(16 + bench_random(&state) % 241);
+            if (!holes[i]) {
+                printf("Memory allocation failed\n");
+                exit(EXIT_FAILURE); // critical error
+            }
+        }
+    }
+    if (layout == 1)
+        for (unsigned int i = n - 1; i > 0; i--){ // Fisher-Yates shuffle of the order of the list
+            unsigned int j = bench_random(&state) % (i + 1);
+            node* temp = b.nodes[i];
+            b.nodes[i] = b.nodes[j];
+            b.nodes[j] = temp;
+        }
+    if (holes){
+        for (unsigned int i = 0; i < n; i++) free(holes[i]);
+        free(holes);
+    }
+
+    bench_relink(&b);
+    b.middle = b.nodes[n / 2];
+    b.before_middle = n / 2 ? b.nodes[n / 2 - 1] : NULL;
+    b.tail = b.nodes[n - 1];
+    return b;
+}
+
+
+/**
+ * @brief Frees the list under measure
+ * @details Time complexity: O(n)
+ * @param b Pointer to the list
+ * @return void Doesn't return a value
+ */
+void bench_free(bench_list* b){
+    for (unsigned int i = 0; i < (*b).n; i++) free((*b).nodes[i]);
+    free((*b).nodes);
+    free((*b).values);
+}
+
+
+
+
+// :::::::::::::::::::::::::::::::::::::::::::::::::: OPERATIONS :::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+/* Each operation runs its function reps times on the list, timing only the calls
+   (one timed batch for the O(1) functions, so the timer doesn't dominate):
+   the list is put back as it was (untimed) when the function changes it.
+   An operation leaves the list linked as bench_relink does. */
+
+long long bench_sink = 0; // results of the calls, so they are not optimized away
+
+/**
+ * @struct bench_operation
+ * @brief Represent a measured function
+ * @details It has the name of the function, whether it walks the list (ns/element is ns/op divided by the nodes)
+ * or is O(1) (ns/element is ns/op), whether the layout changes it (otherwise it is measured once for each data)
+ * and the function running it.
+ * Time complexity: O(1)
+ */
+typedef struct{
+    const char* name;
+    int walks;
+    int uses_layout;
+    void (*run)(bench_list*, unsigned int, bench_timer*);
+} bench_operation;
+
+
+/**
+ * @brief create_node and create_empty_node
+ * @details The nodes are kept in an array and freed after the timed part.
+ * Time complexity: O(reps)
+ * @warning If memory allocation fails prints an error and exit program
+ * @param reps Number of nodes
+ * @param t Pointer to the timer
+ * @param empty 1 for create_empty_node
+ * @return void Doesn't return a value
+ */
+void bench_create_nodes(unsigned int reps, bench_timer* t, int empty){
+    node** created = (node**)malloc(reps * sizeof(node*));
+    if (!created) {
+        printf("Memory allocation failed\n");
+        exit(EXIT_FAILURE); // critical error
+    }
+    bench_timer_start(t);
+    for (unsigned int r = 0; r < reps; r++) created[r] = empty ? create_empty_node() : create_node((int)r);
+    bench_timer_stop(t);
+    for (unsigned int r = 0; r < reps; r++) free(created[r]);
+    free(created);
+}
+
+void bench_create_node(bench_list* b, unsigned int reps, bench_timer* t){ (void)b; bench_create_nodes(reps, t, 0); }
+void bench_create_empty_node(bench_list* b, unsigned int reps, bench_timer* t){ (void)b; bench_create_nodes(reps, t, 1); }
+
+void bench_create_list(bench_list* b, unsigned int reps, bench_timer* t){
+    for (unsigned int r = 0; r < reps; r++){
+        bench_timer_start(t);
+        node* head = create_list((*b).values, (*b).n);
+        bench_timer_stop(t);
+        clear_list(head);
+    }
+}
+
+void bench_print_list(bench_list* b, unsigned int reps, bench_timer* t){
+#if !defined(_WIN32)
+    fflush(stdout);
+    int saved = dup(1);
+    int null = open("/dev/null", O_WRONLY);
+    if (saved < 0 || null < 0) return;
+    dup2(null, 1); // the values are printed to /dev/null
+    for (unsigned int r = 0; r < reps; r++){
+        bench_timer_start(t);
+        print_list((*b).head);
+        fflush(stdout);
+        bench_timer_stop(t);
+    }
+    dup2(saved, 1);
+    close(null);
+    close(saved);
+#else
+    (void)b; (void)reps; (void)t;
+#endif
+}
+
+void bench_clear_list(bench_list* b, unsigned int reps, bench_timer* t){
+    for (unsigned int r = 0; r < reps; r++){
+        node* head = create_list((*b).values, (*b).n);
+        bench_timer_start(t);
+        clear_list(head);
+        bench_timer_stop(t);
+    }
+}
+
+void bench_insertion_head_node(bench_list* b, unsigned int reps, bench_timer* t){ // O(1): timed as one batch
+    node** inserted = (node**)malloc(reps * sizeof(node*));
+    if (!inserted) {
+        printf("Memory allocation failed\n");
+        exit(EXIT_FAILURE); // critical error
+    }
+    for (unsigned int r = 0; r < reps; r++) inserted[r] = create_node(-1);
+    bench_timer_start(t);
+    for (unsigned int r = 0; r < reps; r++) (*b).head = insertion_head_node((*b).head, inserted[r]);
+    bench_timer_stop(t);
+    for (unsigned int r = 0; r < reps; r++) free(inserted[r]);
+    free(inserted);
+    (*b).head = (*b).nodes[0];
+}
+
+void bench_insertion_end_node(bench_list* b, unsigned int reps, bench_timer* t){
+    node* n = create_node(-1);
+    for (unsigned int r = 0; r < reps; r++){
+        bench_timer_start(t);
+        (*b).head = insertion_end_node((*b).head, n);
+        bench_timer_stop(t);
+        (*(*b).tail).next = NULL;
+    }
+    free(n);
+}
+
+void bench_insertion_after_node(bench_list* b, unsigned int reps, bench_timer* t){
+    node* n = create_node(-1);
+    for (unsigned int r = 0; r < reps; r++){
+        bench_timer_start(t);
+        (*b).head = insertion_after_node((*b).head, (*b).middle, n);
+        bench_timer_stop(t);
+        (*(*b).middle).next = (*n).next;
+    }
+    free(n);
+}
+
+void bench_insertion_before_node(bench_list* b, unsigned int reps, bench_timer* t){
+    node* n = create_node(-1);
+    for (unsigned int r = 0; r < reps; r++){
+        bench_timer_start(t);
+        (*b).head = insertion_before_node((*b).head, (*b).middle, n);
+        bench_timer_stop(t);
+        (*(*b).before_middle).next = (*b).middle;
+    }
+    free(n);
+}
+
+void bench_concatenate_lists(bench_list* b, unsigned int reps, bench_timer* t){
+    node* n = create_node(-1);
+    for (unsigned int r = 0; r < reps; r++){
+        bench_timer_start(t);
+        (*b).head = concatenate_lists((*b).head, n);
+        bench_timer_stop(t);
+        (*(*b).tail).next = NULL;
+    }
+    free(n);
+}
+
+void bench_split_list_at_node(bench_list* b, unsigned int reps, bench_timer* t){
+    for (unsigned int r = 0; r < reps; r++){
+        bench_timer_start(t);
+        tuple parts = split_list_at_node((*b).head, (*b).middle);
+        bench_timer_stop(t);
+        (*(*b).middle).next = parts.node2;
+    }
+}
+
+void bench_split_list_at_value(bench_list* b, unsigned int reps, bench_timer* t){
+    node* split = value_in_list((*b).head, (*(*b).middle).value1).node2; // first node with the value
+    for (unsigned int r = 0; r < reps; r++){
+        bench_timer_start(t);
+        tuple parts = split_list_at_value((*b).head, (*(*b).middle).value1);
+        bench_timer_stop(t);
+        (*split).next = parts.node2;
+    }
+}
+
+void bench_remove_node(bench_list* b, unsigned int reps, bench_timer* t){
+    node* next = (*(*b).middle).next;
+    for (unsigned int r = 0; r < reps; r++){
+        bench_timer_start(t);
+        (*b).head = remove_node((*b).head, (*b).middle).node1;
+        bench_timer_stop(t);
+        (*(*b).middle).next = next;
+        (*(*b).before_middle).next = (*b).middle;
+    }
+}
+
+void bench_remove_node_with_value(bench_list* b, unsigned int reps, bench_timer* t){
+    int value = (*(*b).middle).value1;
+    node* prev = NULL;
+    node* removed = (*b).head;
+    while ((*removed).value1 != value){ // first node with the value
+        prev = removed;
+        removed = (*removed).next;
+    }
+    node* next = (*removed).next;
+    for (unsigned int r = 0; r < reps; r++){
+        bench_timer_start(t);
+        (*b).head = remove_node_with_value((*b).head, value).node1;
+        bench_timer_stop(t);
+        (*removed).next = next;
+        if (prev) (*prev).next = removed;
+        else (*b).head = removed;
+    }
+}
+
+void bench_change_node_value(bench_list* b, unsigned int reps, bench_timer* t){
+    bench_timer_start(t);
+    for (unsigned int r = 0; r < reps; r++) (*b).head = change_node_value((*b).head, (*b).middle, (*(*b).middle).value1);
+    bench_timer_stop(t);
+}
+
+void bench_change_node_value_with_value(bench_list* b, unsigned int reps, bench_timer* t){
+    int value = (*(*b).middle).value1;
+    bench_timer_start(t);
+    for (unsigned int r = 0; r < reps; r++) (*b).head = change_node_value_with_value((*b).head, value, value);
+    bench_timer_stop(t);
+}
+
+void bench_is_empty_list(bench_list* b, unsigned int reps, bench_timer* t){
+    bench_timer_start(t);
+    for (unsigned int r = 0; r < reps; r++){
+        bench_sink += is_empty_list((*b).head);
+        __asm__ volatile("" ::: "memory"); // one call for each repetition
+    }
+    bench_timer_stop(t);
+}
+
+void bench_node_in_list(bench_list* b, unsigned int reps, bench_timer* t){
+    bench_timer_start(t);
+    for (unsigned int r = 0; r < reps; r++) bench_sink += node_in_list((*b).head, (*b).middle).node2 != NULL;
+    bench_timer_stop(t);
+}
+
+void bench_value_in_list(bench_list* b, unsigned int reps, bench_timer* t){
+    int value = (*(*b).middle).value1;
+    bench_timer_start(t);
+    for (unsigned int r = 0; r < reps; r++) bench_sink += value_in_list((*b).head, value).node2 != NULL;
+    bench_timer_stop(t);
+}
+
+void bench_reverse_list(bench_list* b, unsigned int reps, bench_timer* t){
+    for (unsigned int r = 0; r < reps; r++){
+        bench_timer_start(t);
+        (*b).head = reverse_list((*b).head);
+        bench_timer_stop(t);
+        bench_relink(b);
+    }
+}
+
+void bench_list_length(bench_list* b, unsigned int reps, bench_timer* t){
+    bench_timer_start(t);
+    for (unsigned int r = 0; r < reps; r++){
+        bench_sink += list_length((*b).head);
+        __asm__ volatile("" ::: "memory");
+    }
+    bench_timer_stop(t);
+}
+
+void bench_max_list(bench_list* b, unsigned int reps, bench_timer* t){
+    bench_timer_start(t);
+    for (unsigned int r = 0; r < reps; r++){
+        bench_sink += max_list((*b).head);
+        __asm__ volatile("" ::: "memory");
+    }
+    bench_timer_stop(t);
+}
+
+void bench_min_list(bench_list* b, unsigned int reps, bench_timer* t){
+    bench_timer_start(t);
+    for (unsigned int r = 0; r < reps; r++){
+        bench_sink += min_list((*b).head);
+        __asm__ volatile("" ::: "memory");
+    }
+    bench_timer_stop(t);
+}
+
+void bench_count_frequents_in_list(bench_list* b, unsigned int reps, bench_timer* t){
+    int value = (*(*b).middle).value1;
+    bench_timer_start(t);
+    for (unsigned int r = 0; r < reps; r++){
+        bench_sink += count_frequents_in_list((*b).head, value);
+        __asm__ volatile("" ::: "memory");
+    }
+    bench_timer_stop(t);
+}
+
+void bench_sort_list(bench_list* b, unsigned int reps, bench_timer* t){
+    for (unsigned int r = 0; r < reps; r++){
+        bench_timer_start(t);
+        (*b).head = sort_list((*b).head);
+        bench_timer_stop(t);
+        bench_relink(b);
+    }
+}
+
+void bench_list_values(bench_list* b, unsigned int reps, bench_timer* t){
+    for (unsigned int r = 0; r < reps; r++){
+        bench_timer_start(t);
+        int* values = list_values((*b).head);
+        bench_timer_stop(t);
+        bench_sink += values[0];
+        free(values);
+    }
+}
+
+const bench_operation BENCH_OPERATIONS[] = {
+    {"create_node", 0, 0, bench_create_node},
+    {"create_empty_node", 0, 0, bench_create_empty_node},
+    {"create_list", 1, 0, bench_create_list},
+    {"print_list", 1, 1, bench_print_list},
+    {"clear_list", 1, 0, bench_clear_list},
+    {"insertion_head_node", 0, 1, bench_insertion_head_node},
+    {"insertion_end_node", 1, 1, bench_insertion_end_node},
+    {"insertion_after_node", 1, 1, bench_insertion_after_node},
+    {"insertion_before_node", 1, 1, bench_insertion_before_node},
+    {"concatenate_lists", 1, 1, bench_concatenate_lists},
+    {"split_list_at_node", 1, 1, bench_split_list_at_node},
+    {"split_list_at_value", 1, 1, bench_split_list_at_value},
+    {"remove_node", 1, 1, bench_remove_node},
+    {"remove_node_with_value", 1, 1, bench_remove_node_with_value},
+    {"change_node_value", 1, 1, bench_change_node_value},
+    {"change_node_value_with_value", 1, 1, bench_change_node_value_with_value},
+    {"is_empty_list", 0, 1, bench_is_empty_list},
+    {"node_in_list", 1, 1, bench_node_in_list},
+    {"value_in_list", 1, 1, bench_value_in_list},
+    {"reverse_list", 1, 1, bench_reverse_list},
+    {"list_length", 1, 1, bench_list_length},
+    {"max_list", 1, 1, bench_max_list},
+    {"min_list", 1, 1, bench_min_list},
+    {"count_frequents_in_list", 1, 1, bench_count_frequents_in_list},
+    {"sort_list", 1, 1, bench_sort_list},
+    {"list_values", 1, 1, bench_list_values},
+};
+#define BENCH_OPERATION_COUNT (sizeof(BENCH_OPERATIONS) / sizeof(BENCH_OPERATIONS[0]))
+
+
+
+
+// :::::::::::::::::::::::::::::::::::::::::::::::::::: REPORT :::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+/* LIST OF FUNCTIONS:
+    1) bench_measure
+    2) bench_print_record
+    3) run_benchmarks */
+
+
+#define BENCH_MAX_REPS (1u << 20)
+
+/**
+ * @brief Measures an operation
+ * @details Doubles the repetitions (or jumps to the estimated number) until the timed part
+ * lasts at least target seconds or BENCH_MAX_REPS repetitions are reached.
+ * Time complexity: O(reps * cost of the operation)
+ * @param op Pointer to the operation
+ * @param b Pointer to the list
+ * @param target Seconds of the timed part
+ * @param t Pointer to the timer, with the result of the last run
+ * @return unsigned int Number of repetitions of the last run
+ */
+unsigned int bench_measure(const bench_operation* op, bench_list* b, double target, bench_timer* t){
+    unsigned int reps = 1;
+    while (1){
+        bench_timer_reset(t);
+        (*op).run(b, reps, t);
+        if ((*t).seconds >= target || reps >= BENCH_MAX_REPS) break;
+
+        double estimate = (*t).seconds > 0 ? target / (*t).seconds * reps * 1.2 : reps * 2.0;
+        if (estimate < reps * 2.0) estimate = reps * 2.0;
+        reps = estimate > BENCH_MAX_REPS ? BENCH_MAX_REPS : (unsigned int)estimate;
+    }
+    bench_timer_read(t);
+    return reps;
+}
+
+
+/**
+ * @brief Prints one measure as a CSV line or a JSON object
+ * @details The counters not available are empty (CSV) or null (JSON).
+ * Time complexity: O(1)
+ * @param json 1 for JSON, 0 for CSV
+ * @param first 1 for the first record (no comma before it in JSON)
+ * @param op Pointer to the operation
+ * @param layout Name of the layout
+ * @param data Name of the data
+ * @param n Number of nodes
+ * @param reps Number of repetitions
+ * @param t Pointer to the timer
+ * @return void Doesn't return a value
+ */
+void bench_print_record(int json, int first, const bench_operation* op, const char* layout, const char* data,
+                        unsigned int n, unsigned int reps, bench_timer* t){
+    double ns_op = (*t).seconds * 1e9 / reps;
+    double ns_element = (*op).walks ? ns_op / n : ns_op;
+    char counters[BENCH_COUNTERS][32];
+    for (int i = 0; i < BENCH_COUNTERS; i++){
+        if ((*t).counts[i] < 0) snprintf(counters[i], sizeof(counters[i]), "%s", json ? "null" : "");
+        else snprintf(counters[i], sizeof(counters[i]), "%.3f", (double)(*t).counts[i] / reps);
+    }
+
+    if (json)
+        printf("%s  {\"operation\": \"%s\", \"layout\": \"%s\", \"data\": \"%s\", \"nodes\": %u, \"repetitions\": %u, "
+               "\"ns_per_op\": %.3f, \"ns_per_element\": %.4f, \"cache_misses_per_op\": %s, \"branch_misses_per_op\": %s}",
+               first ? "" : ",\n", (*op).name, layout, data, n, reps, ns_op, ns_element, counters[0], counters[1]);
+    else printf("%s,%s,%s,%u,%u,%.3f,%.4f,%s,%s\n",
+                (*op).name, layout, data, n, reps, ns_op, ns_element, counters[0], counters[1]);
+    fflush(stdout);
+}
+
+
+/**
+ * @brief Runs every operation on every size, layout and data
+ * @details Sizes 10, 100, ... up to max_nodes. The operations that don't depend on the layout
+ * are measured once for each size and data, with the layout "-".
+ * Time complexity: O(sum of the measures)
+ * @param max_nodes Largest number of nodes
+ * @param target Seconds of the timed part of each measure
+ * @param json 1 for JSON, 0 for CSV
+ * @return void Doesn't return a value
+ */
+void run_benchmarks(unsigned int max_nodes, double target, int json){
+    bench_timer t = bench_timer_create();
+    int first = 1;
+    if (json) printf("[\n");
+    else printf("operation,layout,data,nodes,repetitions,ns_per_op,ns_per_element,cache_misses_per_op,branch_misses_per_op\n");
+
+    for (unsigned long long n = 10; n <= max_nodes; n *= 10)
+        for (int data = 0; data < BENCH_DATA; data++)
+            for (int layout = 0; layout < BENCH_LAYOUTS; layout++){
+                bench_list b = bench_build((unsigned int)n, layout, data);
+                for (unsigned int o = 0; o < BENCH_OPERATION_COUNT; o++){
+                    const bench_operation* op = &BENCH_OPERATIONS[o];
+                    if (!(*op).uses_layout && layout > 0) continue;
+                    unsigned int reps = bench_measure(op, &b, target, &t);
+                    bench_print_record(json, first, op, (*op).uses_layout ? BENCH_LAYOUT_NAMES[layout] : "-",
+                                       BENCH_DATA_NAMES[data], (unsigned int)n, reps, &t);
+                    first = 0;
+                }
+                bench_free(&b);
+            }
+
+    if (json) printf("\n]\n");
+    bench_timer_close(&t);
+    if (bench_sink == 42) fprintf(stderr, " "); // uses the results
+}
+
+
+
+
+// :::::::::::::::::::::::::::::::::::::::::::::::::::::: TESTS ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+/**
+ * @brief Entry point of the program
+ * @details Runs the benchmarks. The optional arguments are the format (csv or json, default csv),
+ * the largest number of nodes (default 1000000, up to 100000000 with enough memory)
+ * and the milliseconds of the timed part of each measure (default 20).
+ * @return 0 on successful execution
+ */
+int main(int argc, char* argv[]){
+    int json = argc > 1 && strcmp(argv[1], "json") == 0;
+    unsigned int max_nodes = argc > 2 ? (unsigned int)strtoul(argv[2], NULL, 10) : 1000000;
+    double target = (argc > 3 ? strtod(argv[3], NULL) : 20) / 1000;
+    run_benchmarks(max_nodes, target, json);
+    return 0;
+
+    /* compiling: gcc -O2 linkedListBenchmark.c -o linkedListBenchmark -lpthread
+    executing: linkedListBenchmark [csv|json [max_nodes [milliseconds]]] */
+}
@@ -0,0 +1,635 @@
+// ::::::::::::::::::::::::::::::::::::::::::::::::: LIBRARIES :::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+/**
+ * @file lockFreeList.c
+ * @author Lorenzo Mercuri
+ * @brief Methods for a sorted list shared by threads without locks
+ * @details Harris-Michael list: a node is removed by marking the lowest bit of its next pointer,
+ * then unlinked with a compare and swap by the thread that removes it or by any thread that finds it.
+ * A removed node is freed with epoch based reclamation: only after every thread has started a new operation,
+ * so the operations publish one epoch instead of a hazard pointer for each node they walk.
+ * (T. Harris, A pragmatic implementation of non-blocking linked-lists: https://doi.org/10.1007/3-540-45414-4_21
+ * M. Michael, High performance dynamic lock-free hash tables and list-based sets: https://doi.org/10.1145/564870.564881
+ * K. Fraser, Practical lock-freedom (epochs, chapter 5): https://www.cl.cam.ac.uk/techreports/UCAM-CL-TR-579.pdf).
+ * linkedList.c is included for the comparison with the list of nodes behind a mutex
+ */
+#define LINKEDLIST_NO_MAIN
+#include "linkedList.c"
+#include <stdatomic.h>
+#include <stdint.h>
+
+
+
+// :::::::::::::::::::::::::::::::::::::::::::::::::: LOCK_FREE_LIST :::::::::::::::::::::::::::::::::::::::::::::::::::::::
+/* LIST OF FUNCTIONS:
+    1) lf_create_list
+    2) lf_clear_list
+    threads:
+        3) lf_thread_register
+        4) lf_thread_unregister
+    epochs:
+        5) lf_free_retired
+        6) lf_enter
+        7) lf_exit
+        8) lf_try_advance
+        9) lf_retire
+    10) lf_find
+    11) lf_insertion
+    12) lf_remove_value
+    13) lf_value_in_list
+    14) lf_list_length */
+
+
+#define LF_MAX_THREADS 64
+#define LF_EPOCHS 3 // nodes removed in the epoch e are freed from the epoch e + 2
+#define LF_RETIRE_LIMIT 64 // removed nodes of the current epoch before trying to advance it
+#define LF_MARK ((uintptr_t)1) // lowest bit of next: the node is removed
+#define LF_ACTIVE 1u // lowest bit of the epoch of a thread: inside an operation
+
+/**
+ * @struct lf_node
+ * @brief Represent a node of a lock-free list
+ * @details It has a value and the pointer to the next node with the removed mark in the lowest bit.
+ * Time complexity: O(1)
+ */
+typedef struct lf_node{
+    int value1; // change type if needed (apply changes to all references)
+    _Atomic uintptr_t next;
+} lf_node;
+
+/**
+ * @struct lf_thread
+ * @brief Represent a thread using a lock-free list
+ * @details It has the epoch seen by the thread (read by every thread)
+ * and the removed nodes waiting to be freed, one array for each of the last LF_EPOCHS epochs (used by the owner only).
+ * Aligned to a cache line, so the threads don't write in the same line.
+ * Time complexity: O(1)
+ */
+typedef struct{
+    _Alignas(64) atomic_uint epoch; // epoch * 2 + LF_ACTIVE inside an operation, 0 outside
+    atomic_int in_use;
+    lf_node** retired[LF_EPOCHS];
+    unsigned int retired_count[LF_EPOCHS];
+    unsigned int retired_capacity[LF_EPOCHS];
+    unsigned int retired_epoch[LF_EPOCHS];
+} lf_thread;
+
+/**
+ * @struct lf_list
+ * @brief Represent a lock-free sorted list without repeated values
+ * @details It has the pointer to the first node, the global epoch and the records of the threads.
+ * Time complexity: O(1)
+ */
+typedef struct{
+    _Atomic uintptr_t head;
+    _Alignas(64) atomic_uint epoch;
+    lf_thread threads[LF_MAX_THREADS];
+} lf_list;
+
+
+/**
+ * @brief Create a new empty lock-free list
+ * @details Time complexity: O(LF_MAX_THREADS)
+ * @warning If memory allocation fails prints an error and exit program
+ * @return lf_list* Pointer to the new list
+ */
+lf_list* lf_create_list(){
+    lf_list* l = (lf_list*)malloc(sizeof(lf_list));
+    if (!l) {
+        printf("Memory allocation failed\n");
+        exit(EXIT_FAILURE); // critical error
+    }
+
+    atomic_init(&(*l).head, (uintptr_t)0);
+    atomic_init(&(*l).epoch, 2u);
+    for (int t = 0; t < LF_MAX_THREADS; t++){
+        atomic_init(&(*l).threads[t].epoch, 0u);
+        atomic_init(&(*l).threads[t].in_use, 0);
+        for (int e = 0; e < LF_EPOCHS; e++){
+            (*l).threads[t].retired[e] = NULL;
+            (*l).threads[t].retired_count[e] = (*l).threads[t].retired_capacity[e] = 0;
+            (*l).threads[t].retired_epoch[e] = 0;
+        }
+    }
+    return l;
+}
+
+
+/**
+ * @brief Frees the memory allocated for a lock-free list
+ * @details The nodes, the removed nodes not freed yet and the list.
+ * To be called when no thread uses the list.
+ * Time complexity: O(n + r), n = number of nodes in the list, r = number of removed nodes not freed yet
+ * @param l Pointer to the list
+ * @return void Doesn't return a value
+ */
+void lf_clear_list(lf_list* l){
+    if (!l) return;
+
+    uintptr_t temp = atomic_load(&(*l).head);
+    while (temp){
+        lf_node* n = (lf_node*)(temp & ~LF_MARK);
+        temp = atomic_load(&(*n).next);
+        free(n); // deallocate memory
+    }
+    for (int t = 0; t < LF_MAX_THREADS; t++)
+        for (int e = 0; e < LF_EPOCHS; e++){
+            for (unsigned int i = 0; i < (*l).threads[t].retired_count[e]; i++) free((*l).threads[t].retired[e][i]);
+            free((*l).threads[t].retired[e]);
+        }
+    free(l);
+}
+
+
+/**
+ * @brief Takes a free thread record of a lock-free list
+ * @details Every thread calls it before using the list.
+ * The removed nodes left by a previous owner of the record are inherited.
+ * Time complexity: O(LF_MAX_THREADS)
+ * @param l Pointer to the list
+ * @return lf_thread* Pointer to the record, NULL if LF_MAX_THREADS threads already use the list
+ */
+lf_thread* lf_thread_register(lf_list* l){
+    for (int t = 0; t < LF_MAX_THREADS; t++){
+        int expected = 0;
+        if (atomic_compare_exchange_strong(&(*l).threads[t].in_use, &expected, 1)) return &(*l).threads[t];
+    }
+    return NULL;
+}
+
+/**
+ * @brief Releases the thread record of a lock-free list
+ * @details Time complexity: O(1)
+ * @param t Pointer to the record
+ * @return void Doesn't return a value
+ */
+void lf_thread_unregister(lf_thread* t){
+    if (!t) return;
+
+    atomic_store(&(*t).epoch, 0u);
+    atomic_store(&(*t).in_use, 0);
+}
+
+
+/**
+ * @brief Frees the removed nodes of a thread that no thread can still be reading
+ * @details The nodes retired in the global epoch e are freed if the global epoch is at least e + 2:
+ * every thread has started a new operation since they were unlinked.
+ * Time complexity: O(r), r = number of nodes freed
+ * @param t Pointer to the thread record
+ * @param epoch The global epoch
+ * @return void Doesn't return a value
+ */
+void lf_free_retired(lf_thread* t, unsigned int epoch){
+    for (int e = 0; e < LF_EPOCHS; e++){
+        if (!(*t).retired_count[e] || (*t).retired_epoch[e] + 2 > epoch) continue;
+        for (unsigned int i = 0; i < (*t).retired_count[e]; i++) free((*t).retired[e][i]); // deallocate memory
+        (*t).retired_count[e] = 0;
+    }
+}
+
+/**
+ * @brief Starts an operation of a thread on a lock-free list
+ * @details Publishes the global epoch as the epoch of the thread, then a full fence orders that store
+ * before the loads of the nodes (a store followed by acquire loads may be reordered otherwise,
+ * and a thread advancing the epoch could miss this one), then frees the removed nodes that are old enough.
+ * Time complexity: O(1) amortized
+ * @param l Pointer to the list
+ * @param t Pointer to the thread record
+ * @return void Doesn't return a value
+ */
+void lf_enter(lf_list* l, lf_thread* t){
+    unsigned int epoch = atomic_load(&(*l).epoch);
+    atomic_store(&(*t).epoch, epoch * 2 + LF_ACTIVE);
+    atomic_thread_fence(memory_order_seq_cst);
+    lf_free_retired(t, epoch);
+}
+
+/**
+ * @brief Ends an operation of a thread on a lock-free list
+ * @details The thread no longer reads nodes, so it doesn't stop the epoch.
+ * Time complexity: O(1)
+ * @param t Pointer to the thread record
+ * @return void Doesn't return a value
+ */
+void lf_exit(lf_thread* t){
+    atomic_store_explicit(&(*t).epoch, 0u, memory_order_release);
+}
+
+/**
+ * @brief Advances the global epoch if every thread inside an operation has seen it
+ * @details Time complexity: O(LF_MAX_THREADS)
+ * @param l Pointer to the list
+ * @return void Doesn't return a value
+ */
+void lf_try_advance(lf_list* l){
+    unsigned int epoch = atomic_load(&(*l).epoch);
+    for (int t = 0; t < LF_MAX_THREADS; t++){
+        unsigned int seen = atomic_load(&(*l).threads[t].epoch);
+        if ((seen & LF_ACTIVE) && seen / 2 != epoch) return; // a thread is still in an older epoch
+    }
+    atomic_compare_exchange_strong(&(*l).epoch, &epoch, epoch + 1);
+}
+
+/**
+ * @brief Adds an unlinked node to the removed nodes of a thread
+ * @details The node waits in the array of the global epoch read after it was unlinked:
+ * the epoch of the thread can be older, and a thread that entered in the newer epoch may still read the node.
+ * After LF_RETIRE_LIMIT nodes in that array, tries to advance the global epoch.
+ * Time complexity: O(1) amortized
+ * @warning If memory allocation fails prints an error and exit program
+ * @param l Pointer to the list
+ * @param t Pointer to the thread record, inside an operation
+ * @param n Pointer to the node, no longer reachable from the head
+ * @return void Doesn't return a value
+ */
+void lf_retire(lf_list* l, lf_thread* t, lf_node* n){
+    unsigned int epoch = atomic_load(&(*l).epoch);
+    int e = (int)(epoch % LF_EPOCHS);
+    if ((*t).retired_count[e] && (*t).retired_epoch[e] != epoch) lf_free_retired(t, epoch); // older epoch, free now
+    (*t).retired_epoch[e] = epoch;
+
+    if ((*t).retired_count[e] == (*t).retired_capacity[e]){
+        unsigned int capacity = (*t).retired_capacity[e] ? (*t).retired_capacity[e] * 2 : LF_RETIRE_LIMIT;
+        lf_node** retired = (lf_node**)realloc((*t).retired[e], capacity * sizeof(lf_node*));
+        if (!retired) {
+            printf("Memory allocation failed\n");
+            exit(EXIT_FAILURE); // critical error
+        }
+        (*t).retired[e] = retired;
+        (*t).retired_capacity[e] = capacity;
+    }
+    (*t).retired[e][(*t).retired_count[e]++] = n;
+    if ((*t).retired_count[e] % LF_RETIRE_LIMIT == 0) lf_try_advance(l);
+}
+
+
+/**
+ * @brief Finds the position of a value in a lock-free list
+ * @details Walks the list unlinking the marked nodes found on the way;
+ * restarts from the head when the unlinking fails (the previous node changed or got marked).
+ * On return cur is the first node with value >= value (or NULL) and prev the field that points to it.
+ * To be called inside an operation (lf_enter), so the nodes read are not freed.
+ * Time complexity: O(n) expected, n = number of nodes in the list
+ * @param l Pointer to the list
+ * @param t Pointer to the thread record
+ * @param value The value to search
+ * @param prev Where the pointer to the next field of the previous node (or to the head) is written
+ * @param cur Where the current node is written
+ * @return int 1 if cur has the value, 0 otherwise
+ */
+int lf_find(lf_list* l, lf_thread* t, int value, _Atomic uintptr_t** prev, lf_node** cur){
+try_again:
+    *prev = &(*l).head;
+    *cur = (lf_node*)atomic_load_explicit(*prev, memory_order_acquire);
+    while (*cur){
+        uintptr_t link = atomic_load_explicit(&(**cur).next, memory_order_acquire);
+        lf_node* next = (lf_node*)(link & ~LF_MARK);
+
+        if (link & LF_MARK){ // cur is removed: unlink it
+            uintptr_t expected = (uintptr_t)*cur;
+            if (!atomic_compare_exchange_strong(*prev, &expected, (uintptr_t)next)) goto try_again;
+            lf_retire(l, t, *cur);
+        } else {
+            if ((**cur).value1 >= value) return (**cur).value1 == value;
+            *prev = &(**cur).next;
+        }
+        *cur = next;
+    }
+    return 0;
+}
+
+
+/**
+ * @brief Inserts a value in a lock-free list
+ * @details The new node is linked with a compare and swap on the previous pointer.
+ * Time complexity: O(n) expected, n = number of nodes in the list
+ * @warning If memory allocation fails prints an error and exit program
+ * @param l Pointer to the list
+ * @param t Pointer to the thread record of the calling thread
+ * @param value The value to insert
+ * @return int 1 if the value is inserted, 0 if it was already in the list
+ */
+int lf_insertion(lf_list* l, lf_thread* t, int value){
+    lf_node* n = (lf_node*)malloc(sizeof(lf_node));
+    if (!n) {
+        printf("Memory allocation failed\n");
+        exit(EXIT_FAILURE); // critical error
+    }
+    (*n).value1 = value;
+
+    _Atomic uintptr_t* prev;
+    lf_node* cur;
+    int inserted = 0;
+    lf_enter(l, t);
+    while (1){
+        if (lf_find(l, t, value, &prev, &cur)){
+            free(n); // never shared
+            break;
+        }
+        atomic_store_explicit(&(*n).next, (uintptr_t)cur, memory_order_relaxed);
+        uintptr_t expected = (uintptr_t)cur;
+        if (atomic_compare_exchange_strong(prev, &expected, (uintptr_t)n)){
+            inserted = 1;
+            break;
+        }
+    }
+    lf_exit(t);
+    return inserted;
+}
+
+
+/**
+ * @brief Removes a value from a lock-free list
+ * @details Marks the next pointer of the node (the logical removal), then tries to unlink it;
+ * if another thread changed the previous node, lf_find unlinks it.
+ * Time complexity: O(n) expected, n = number of nodes in the list
+ * @param l Pointer to the list
+ * @param t Pointer to the thread record of the calling thread
+ * @param value The value to remove
+ * @return int 1 if the value is removed, 0 if it was not in the list
+ */
+int lf_remove_value(lf_list* l, lf_thread* t, int value){
+    _Atomic uintptr_t* prev;
+    lf_node* cur;
+    int removed = 0;
+    lf_enter(l, t);
+    while (lf_find(l, t, value, &prev, &cur)){
+        uintptr_t link = atomic_load(&(*cur).next);
+        if (link & LF_MARK) continue; // removed by another thread: lf_find unlinks it
+        if (!atomic_compare_exchange_strong(&(*cur).next, &link, link | LF_MARK)) continue; // next changed
+
+        uintptr_t expected = (uintptr_t)cur;
+        if (atomic_compare_exchange_strong(prev, &expected, link)) lf_retire(l, t, cur);
+        else lf_find(l, t, value, &prev, &cur);
+        removed = 1;
+        break;
+    }
+    lf_exit(t);
+    return removed;
+}
+
+
+/**
+ * @brief Checks if a value is in a lock-free list
+ * @details Time complexity: O(n) expected, n = number of nodes in the list
+ * @param l Pointer to the list
+ * @param t Pointer to the thread record of the calling thread
+ * @param value The value to search
+ * @return int 1 if the value is in the list, 0 otherwise
+ */
+int lf_value_in_list(lf_list* l, lf_thread* t, int value){
+    _Atomic uintptr_t* prev;
+    lf_node* cur;
+    lf_enter(l, t);
+    int found = lf_find(l, t, value, &prev, &cur);
+    lf_exit(t);
+    return found;
+}
+
+
+/**
+ * @brief Counts the nodes of a lock-free list not marked as removed
+ * @details To be called when no thread changes the list.
+ * Time complexity: O(n), n = number of nodes in the list
+ * @param l Pointer to the list
+ * @return unsigned int The number of values in the list
+ */
+unsigned int lf_list_length(lf_list* l){
+    unsigned int length = 0;
+    for (uintptr_t temp = atomic_load(&(*l).head); temp; ){
+        lf_node* n = (lf_node*)(temp & ~LF_MARK);
+        temp = atomic_load(&(*n).next);
+        if (!(temp & LF_MARK)) length++;
+    }
+    return length;
+}
+
+
+
+// :::::::::::::::::::::::::::::::::::::::::::::::::: BENCHMARKS :::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+/**
+ * @struct locked_list
+ * @brief Represent a sorted list of nodes behind one mutex, the comparison for the lock-free list
+ * Time complexity: O(1)
+ */
+typedef struct{
+    pthread_mutex_t lock;
+    node* head;
+} locked_list;
+
+/**
+ * @brief Inserts, removes or searches a value in a locked list
+ * @details The list stays sorted without repeated values.
+ * Time complexity: O(n), n = number of nodes in the list
+ * @warning If memory allocation fails prints an error and exit program
+ * @param l Pointer to the locked list
+ * @param operation 0 search, 1 insert, 2 remove
+ * @param value The value
+ * @return int 1 if the value was found (search), inserted or removed, 0 otherwise
+ */
+int locked_operation(locked_list* l, int operation, int value){
+    pthread_mutex_lock(&(*l).lock);
+    node* prev = NULL;
+    node* temp = (*l).head;
+    while (temp && (*temp).value1 < value){
+        prev = temp;
+        temp = (*temp).next;
+    }
+    int found = temp && (*temp).value1 == value;
+    int result = operation == 0 ? found : operation == 1 ? !found : found;
+
+    if (operation == 1 && !found){
+        node* n = create_node(value);
+        (*n).next = temp;
+        if (prev) (*prev).next = n;
+        else (*l).head = n;
+    } else if (operation == 2 && found){
+        if (prev) (*prev).next = (*temp).next;
+        else (*l).head = (*temp).next;
+        free(temp); // deallocate memory
+    }
+    pthread_mutex_unlock(&(*l).lock);
+    return result;
+}
+
+
+/**
+ * @struct lf_job
+ * @brief Represent the work of a thread of the stress test or of the benchmark
+ * Time complexity: O(1)
+ */
+typedef struct{
+    lf_list* list; // NULL for the locked list
+    locked_list* locked;
+    unsigned int operations;
+    int keys; // values from 0 to keys - 1
+    int search_percent; // the rest is half insertions, half removals
+    unsigned int seed;
+    atomic_int* balance; // stress test: insertions - removals of each value (NULL in the benchmark)
+} lf_job;
+
+/**
+ * @brief Thread function of the stress test and of the benchmark
+ * @details Random operations on random values, counted in balance if not NULL.
+ * Time complexity: O(operations * keys)
+ * @param arg Pointer to the lf_job
+ * @return void* NULL
+ */
+void* lf_worker(void* arg){
+    lf_job* job = (lf_job*)arg;
+    lf_thread* t = (*job).list ? lf_thread_register((*job).list) : NULL;
+    unsigned int x = (*job).seed;
+
+    for (unsigned int i = 0; i < (*job).operations; i++){
+        x ^= x << 13; // xorshift
+        x ^= x >> 17;
+        x ^= x << 5;
+        int value = (int)((x >> 8) % (unsigned int)(*job).keys);
+        int choice = (int)(x % 100);
+        int operation = choice < (*job).search_percent ? 0 : (choice - (*job).search_percent) % 2 + 1;
+
+        int done;
+        if (t) done = operation == 0 ? lf_value_in_list((*job).list, t, value)
+                      : operation == 1 ? lf_insertion((*job).list, t, value) : lf_remove_value((*job).list, t, value);
+        else done = locked_operation((*job).locked, operation, value);
+        if ((*job).balance && done && operation) atomic_fetch_add(&(*job).balance[value], operation == 1 ? 1 : -1);
+    }
+    lf_thread_unregister(t);
+    return NULL;
+}
+
+/**
+ * @brief Runs the jobs on threads and measures the wall time
+ * @details Time complexity: the time of the longest job
+ * @param jobs Array of the jobs
+ * @param threads Number of jobs
+ * @return double Seconds
+ */
+double lf_run_jobs(lf_job jobs[], unsigned int threads){
+    pthread_t ids[LF_MAX_THREADS];
+    int started[LF_MAX_THREADS];
+    double start = wall_seconds();
+    for (unsigned int i = 0; i < threads; i++){
+        started[i] = pthread_create(&ids[i], NULL, lf_worker, &jobs[i]) == 0;
+        if (!started[i]) lf_worker(&jobs[i]);
+    }
+    for (unsigned int i = 0; i < threads; i++) if (started[i]) pthread_join(ids[i], NULL);
+    return wall_seconds() - start;
+}
+
+
+/**
+ * @brief Stress test of the lock-free list
+ * @details Threads insert and remove random values from a small range (many conflicts),
+ * counting the successful operations for each value. At the end the list must be sorted,
+ * without marked nodes, and contain exactly the values inserted once more than removed.
+ * Time complexity: O(threads * operations * keys)
+ * @param threads Number of threads (at most LF_MAX_THREADS)
+ * @param operations Number of operations of each thread
+ * @return int 1 if the test passes, 0 otherwise
+ */
+int lf_stress_test(unsigned int threads, unsigned int operations){
+    if (threads > LF_MAX_THREADS) threads = LF_MAX_THREADS;
+    const int keys = 64;
+    atomic_int balance[64];
+    for (int k = 0; k < keys; k++) atomic_init(&balance[k], 0);
+
+    lf_list* l = lf_create_list();
+    lf_job jobs[LF_MAX_THREADS];
+    for (unsigned int i = 0; i < threads; i++){
+        lf_job job = {l, NULL, operations, keys, 20, 2463534242u + 7919u * i, balance};
+        jobs[i] = job;
+    }
+    double elapsed = lf_run_jobs(jobs, threads);
+
+    int passed = 1, previous = -1;
+    unsigned int length = 0;
+    for (uintptr_t temp = atomic_load(&(*l).head); temp; ){
+        lf_node* n = (lf_node*)temp;
+        temp = atomic_load(&(*n).next);
+        if ((temp & LF_MARK) || (*n).value1 <= previous || atomic_load(&balance[(*n).value1]) != 1) passed = 0;
+        previous = (*n).value1;
+        length++;
+    }
+    unsigned int expected = 0, pending = 0;
+    for (int k = 0; k < keys; k++){
+        int b = atomic_load(&balance[k]);
+        if (b != 0 && b != 1) passed = 0;
+        expected += b == 1;
+    }
+    if (length != expected) passed = 0;
+    for (int t = 0; t < LF_MAX_THREADS; t++)
+        for (int e = 0; e < LF_EPOCHS; e++) pending += (*l).threads[t].retired_count[e];
+
+    printf("stress test %s: %u threads, %u operations each, %.3f s, %u values, %u removed nodes waiting\n",
+           passed ? "passed" : "FAILED", threads, operations, elapsed, length, pending);
+    lf_clear_list(l);
+    return passed;
+}
+
+
+/**
+ * @brief Throughput of the lock-free list and of the locked list
+ * @details For 1 to max_threads threads and two workloads (90% and 50% searches, the rest insertions and removals)
+ * on 512 values, with the list half full, prints millions of operations per second.
+ * Time complexity: O(max_threads^2 * operations * 512)
+ * @param max_threads Largest number of threads
+ * @param operations Number of operations of each thread
+ * @return void Doesn't return a value
+ */
+void benchmark_lock_free(unsigned int max_threads, unsigned int operations){
+    if (max_threads > LF_MAX_THREADS) max_threads = LF_MAX_THREADS;
+    const int keys = 512;
+    int search_percents[] = {90, 50};
+
+    for (int w = 0; w < 2; w++)
+        for (unsigned int threads = 1; threads <= max_threads; threads++){
+            double rates[2];
+            for (int k = 0; k < 2; k++){
+                lf_list* l = k ? NULL : lf_create_list();
+                locked_list locked = {PTHREAD_MUTEX_INITIALIZER, NULL};
+                lf_thread* t = l ? lf_thread_register(l) : NULL;
+                for (int v = 0; v < keys; v += 2){
+                    if (l) lf_insertion(l, t, v);
+                    else locked_operation(&locked, 1, v);
+                }
+                lf_thread_unregister(t);
+
+                lf_job jobs[LF_MAX_THREADS];
+                for (unsigned int i = 0; i < threads; i++){
+                    lf_job job = {l, &locked, operations, keys, search_percents[w], 2463534242u + 7919u * i, NULL};
+                    jobs[i] = job;
+                }
+                double elapsed = lf_run_jobs(jobs, threads);
+                rates[k] = elapsed > 0 ? threads * (double)operations / elapsed / 1e6 : 0;
+
+                if (l) lf_clear_list(l);
+                clear_list(locked.head);
+                pthread_mutex_destroy(&locked.lock);
+            }
+            printf("%d%% searches, %u threads: lock-free %.2f Mops/s, mutex %.2f Mops/s\n",
+                   search_percents[w], threads, rates[0], rates[1]);
+        }
+}
+
+
+
+// :::::::::::::::::::::::::::::::::::::::::::::::::::::: TESTS ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+/**
+ * @brief Entry point of the program, used for testing
+ * @details Runs the stress test, then the benchmark
+ * (the optional arguments are the number of threads, default 4, and of operations for each thread, default 200000).
+ * @return 0 if the stress test passes, 1 otherwise
+ */
+int main(int argc, char* argv[]){
+    unsigned int threads = argc > 1 ? (unsigned int)strtoul(argv[1], NULL, 10) : 4;
+    unsigned int operations = argc > 2 ? (unsigned int)strtoul(argv[2], NULL, 10) : 200000;
+    if (threads == 0) threads = 1;
+
+    int passed = lf_stress_test(threads, operations);
+    benchmark_lock_free(threads, operations);
+    return passed ? 0 : 1;
+
+    /* compiling: gcc lockFreeList.c -o lockFreeList -lpthread
+    executing: lockFreeList [threads [operations]] */
+}
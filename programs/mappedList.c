@@ -0,0 +1,570 @@
+// ::::::::::::::::::::::::::::::::::::::::::::::::: LIBRARIES :::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+/**
+ * @file mappedList.c
+ * @author Lorenzo Mercuri
+ * @brief Methods for lists stored in files and mapped in memory
+ * @details A list is saved as a header and an array of nodes, each with its value and the distance (in nodes)
+ * to the next node instead of a pointer, so the file is used where it is mapped without changes:
+ * opening a list is one mmap, and the pages are read from the disk (or the page cache) when the list is walked.
+ * A list opened for changes is mapped copy on write: the changed pages are private and the file is unchanged.
+ * The file is in the byte order of the machine that saved it, and it is trusted:
+ * only the header is checked when it is opened.
+ * Without mmap (_WIN32) the file is read in memory.
+ * (mmap: https://man7.org/linux/man-pages/man2/mmap.2.html).
+ * linkedList.c is included for the lists to save and the aggregates
+ */
+#define LINKEDLIST_NO_MAIN
+#include "linkedList.c"
+#include <stdint.h>
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+
+
+// :::::::::::::::::::::::::::::::::::::::::::::::::: MAPPED_LIST ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+/* LIST OF FUNCTIONS:
+    1) mapped_save_list
+    2) mapped_open
+    3) mapped_close
+    walk:
+        4) mapped_first
+        5) mapped_next
+    6) mapped_print
+    7) mapped_length
+    8) mapped_value_in
+    9) mapped_count_frequents
+    10) mapped_max
+    11) mapped_min
+    12) mapped_aggregate
+    changes (copy on write):
+        13) mapped_change_node_value_with_value
+        14) mapped_remove_node_with_value
+    15) mapped_to_linked_list */
+
+
+#define MAPPED_MAGIC "LISTMAP" // 8 bytes with the terminator
+#define MAPPED_VERSION 1u
+#define MAPPED_BYTE_ORDER 0x01020304u // read back as another number on a machine with another byte order
+#define MAPPED_WRITE_NODES 4096 // nodes written with each fwrite
+
+/**
+ * @struct mapped_header
+ * @brief Represent the header at the start of a list file
+ * @details Fixed size fields: the magic string, the version of the format, the size of a node,
+ * the byte order mark, the number of nodes in the list, the number of nodes stored in the file
+ * and the index of the first node. 48 bytes, so the nodes after it are aligned.
+ * Time complexity: O(1)
+ */
+typedef struct{
+    char magic[8];
+    uint32_t version;
+    uint32_t node_size;
+    uint32_t byte_order;
+    uint32_t reserved;
+    uint64_t length;
+    uint64_t capacity;
+    int64_t head; // -1 if the list is empty
+} mapped_header;
+
+/**
+ * @struct mnode
+ * @brief Represent a node of a list file
+ * @details It has a value and the distance from this node to the next one, in nodes (0 for the last node).
+ * Time complexity: O(1)
+ */
+typedef struct{
+    int32_t value1; // value1 of node, fixed size in the file
+    int32_t next;
+} mnode;
+
+/**
+ * @struct mapped_list
+ * @brief Represent a list file mapped in memory
+ * @details It has the mapped bytes, their size, the header, the nodes and whether the mapping can be changed.
+ * Time complexity: O(1)
+ */
+typedef struct{
+    unsigned char* base; // NULL if the file could not be opened
+    size_t size;
+    mapped_header* header;
+    mnode* nodes;
+    int writable;
+} mapped_list;
+
+
+/**
+ * @brief Saves a linked list in a file
+ * @details The nodes are written in the order of the list, so each node is followed by the next one (distance 1).
+ * Time complexity: O(n), n = number of nodes in the list
+ * @param head Pointer to the head of the linked list
+ * @param path Path of the file (replaced if it exists)
+ * @return int 1 if the list is saved, 0 if the file could not be written
+ */
+int mapped_save_list(node* head, const char* path){
+    if (!path) return 0;
+    FILE* f = fopen(path, "wb");
+    if (!f) return 0;
+
+    mapped_header header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, MAPPED_MAGIC, sizeof(header.magic));
+    header.version = MAPPED_VERSION;
+    header.node_size = sizeof(mnode);
+    header.byte_order = MAPPED_BYTE_ORDER;
+    header.length = header.capacity = (uint64_t)list_length(head);
+    header.head = head ? 0 : -1;
+    int ok = fwrite(&header, sizeof(header), 1, f) == 1;
+
+    mnode buffer[MAPPED_WRITE_NODES];
+    unsigned int used = 0;
+    for (node* temp = head; temp && ok; temp = (*temp).next){
+        buffer[used].value1 = (*temp).value1;
+        buffer[used].next = (*temp).next ? 1 : 0;
+        if (++used == MAPPED_WRITE_NODES){
+            ok = fwrite(buffer, sizeof(mnode), used, f) == used;
+            used = 0;
+        }
+    }
+    if (ok && used) ok = fwrite(buffer, sizeof(mnode), used, f) == used;
+    if (fclose(f) != 0) ok = 0;
+    return ok;
+}
+
+
+/**
+ * @brief Opens a list file
+ * @details Maps the file read only and shared (the pages are the ones of the page cache),
+ * or copy on write if writable (the changes stay in memory and are lost with mapped_close).
+ * Checks the header: magic, version, node size, byte order, file size and head.
+ * Time complexity: O(1) (the nodes are read when they are used)
+ * @param path Path of the file
+ * @param writable 1 to change the list in memory, 0 to only read it
+ * @return mapped_list The opened list, with base NULL if the file can't be opened or is not a list file
+ */
+mapped_list mapped_open(const char* path, int writable){
+    mapped_list m = {NULL, 0, NULL, NULL, writable};
+    if (!path) return m;
+
+#if defined(_WIN32)
+    FILE* f = fopen(path, "rb");
+    if (!f) return m;
+    if (fseek(f, 0, SEEK_END) != 0){
+        fclose(f);
+        return m;
+    }
+    long size = ftell(f);
+    rewind(f);
+    if (size < (long)sizeof(mapped_header)){
+        fclose(f);
+        return m;
+    }
+    unsigned char* base = (unsigned char*)malloc((size_t)size);
+    if (!base) {
+        printf("Memory allocation failed\n");
+        exit(EXIT_FAILURE); // critical error
+    }
+    int read = fread(base, 1, (size_t)size, f) == (size_t)size;
+    fclose(f);
+    if (!read){
+        free(base);
+        return m;
+    }
+    m.writable = 1; // the copy in memory can always be changed
+#else
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return m;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof(mapped_header)){
+        close(fd);
+        return m;
+    }
+    size_t size = (size_t)st.st_size;
+    void* mapped = mmap(NULL, size, writable ? PROT_READ | PROT_WRITE : PROT_READ,
+                        writable ? MAP_PRIVATE : MAP_SHARED, fd, 0);
+    close(fd); // the mapping keeps the file
+    if (mapped == MAP_FAILED) return m;
+    unsigned char* base = (unsigned char*)mapped;
+#endif
+
+    mapped_header* header = (mapped_header*)base;
+    uint64_t max_nodes = ((uint64_t)size - sizeof(mapped_header)) / sizeof(mnode);
+    if (memcmp((*header).magic, MAPPED_MAGIC, sizeof((*header).magic)) != 0 || (*header).version != MAPPED_VERSION
+        || (*header).node_size != sizeof(mnode) || (*header).byte_order != MAPPED_BYTE_ORDER
+        || (*header).capacity > max_nodes || (*header).length > (*header).capacity
+        || (*header).head < -1 || (*header).head >= (int64_t)(*header).capacity
+        || ((*header).head == -1) != ((*header).length == 0)){
+#if defined(_WIN32)
+        free(base);
+#else
+        munmap(base, size);
+#endif
+        return m;
+    }
+
+    m.base = base;
+    m.size = (size_t)size;
+    m.header = header;
+    m.nodes = (mnode*)(base + sizeof(mapped_header));
+    return m;
+}
+
+
+/**
+ * @brief Closes a list file
+ * @details Unmaps the file, the changes of a writable list are lost.
+ * Time complexity: O(1)
+ * @param m Pointer to the opened list
+ * @return void Doesn't return a value
+ */
+void mapped_close(mapped_list* m){
+    if (!m || !(*m).base) return;
+
+#if defined(_WIN32)
+    free((*m).base);
+#else
+    munmap((*m).base, (*m).size);
+#endif
+    (*m).base = NULL;
+    (*m).header = NULL;
+    (*m).nodes = NULL;
+    (*m).size = 0;
+}
+
+
+/**
+ * @brief First node of a list file
+ * @details Time complexity: O(1)
+ * @param m Pointer to the opened list
+ * @return mnode* Pointer to the first node, NULL if the list is empty
+ */
+mnode* mapped_first(mapped_list* m){
+    if (!m || !(*m).base || (*(*m).header).head < 0) return NULL;
+    return &(*m).nodes[(*(*m).header).head];
+}
+
+/**
+ * @brief Next node of a list file
+ * @details Time complexity: O(1)
+ * @param n Pointer to a node of the list
+ * @return mnode* Pointer to the next node, NULL after the last node
+ */
+mnode* mapped_next(mnode* n){
+    return n && (*n).next ? n + (*n).next : NULL;
+}
+
+
+/**
+ * @brief Prints the values of each node of a list file
+ * @details Time complexity: O(n), n = number of nodes in the list
+ * @param m Pointer to the opened list
+ * @return void Doesn't return a value
+ */
+void mapped_print(mapped_list* m){
+    mnode* temp = mapped_first(m);
+    if (!temp) return;
+
+    printf("[");
+    for (; temp; temp = mapped_next(temp)) printf((*temp).next ? "%d, " : "%d]", (*temp).value1);
+}
+
+
+/**
+ * @brief Length of a list file
+ * @details Read from the header.
+ * Time complexity: O(1)
+ * @param m Pointer to the opened list
+ * @return unsigned long long The number of nodes in the list
+ */
+unsigned long long mapped_length(mapped_list* m){
+    return m && (*m).base ? (unsigned long long)(*(*m).header).length : 0;
+}
+
+
+/**
+ * @brief Searches for a value in a list file
+ * @details Time complexity: O(n), n = number of nodes seen in the list
+ * @param m Pointer to the opened list
+ * @param value Value to be searched for in the list
+ * @return mnode* Pointer to the first node with the searched value.
+ * If the value is not found returns NULL
+ */
+mnode* mapped_value_in(mapped_list* m, int value){
+    mnode* temp = mapped_first(m);
+    while (temp && (*temp).value1 != value) temp = mapped_next(temp);
+    return temp;
+}
+
+
+/**
+ * @brief Counts the frequency of a value in a list file
+ * @details Time complexity: O(n), n = number of nodes in the list
+ * @param m Pointer to the opened list
+ * @param value The value to count the frequency of in the list
+ * @return unsigned long long The frequency of the value
+ */
+unsigned long long mapped_count_frequents(mapped_list* m, int value){
+    unsigned long long freq = 0;
+    for (mnode* temp = mapped_first(m); temp; temp = mapped_next(temp))
+        if ((*temp).value1 == value) freq++;
+    return freq;
+}
+
+
+/**
+ * @brief Max value of a list file
+ * @details Time complexity: O(n), n = number of nodes in the list
+ * @param m Pointer to the opened list
+ * @return int The max value of the list.
+ * If the list is empty return the default value of a node
+ */
+int mapped_max(mapped_list* m){
+    mnode* temp = mapped_first(m);
+    if (!temp) return DEFAULT_VALUE;
+
+    int max = (*temp).value1;
+    for (; temp; temp = mapped_next(temp))
+        if ((*temp).value1 > max) max = (*temp).value1;
+    return max;
+}
+
+/**
+ * @brief Min value of a list file
+ * @details Time complexity: O(n), n = number of nodes in the list
+ * @param m Pointer to the opened list
+ * @return int The min value of the list.
+ * If the list is empty return the default value of a node
+ */
+int mapped_min(mapped_list* m){
+    mnode* temp = mapped_first(m);
+    if (!temp) return DEFAULT_VALUE;
+
+    int min = (*temp).value1;
+    for (; temp; temp = mapped_next(temp))
+        if ((*temp).value1 < min) min = (*temp).value1;
+    return min;
+}
+
+
+/**
+ * @brief Computes the selected aggregates of a list file in one pass
+ * @details As aggregate_list, on the nodes of the file.
+ * Time complexity: O(n), n = number of nodes in the list
+ * @param m Pointer to the opened list
+ * @param which Bitwise OR of AGGREGATE_MIN, AGGREGATE_MAX, AGGREGATE_LENGTH and AGGREGATE_FREQUENCY
+ * @param value The value counted by AGGREGATE_FREQUENCY
+ * @return aggregates The selected aggregates (min and max are the default value if the list is empty)
+ */
+aggregates mapped_aggregate(mapped_list* m, unsigned int which, int value){
+    aggregates result = {DEFAULT_VALUE, DEFAULT_VALUE, 0, 0};
+    mnode* temp = mapped_first(m);
+    if (!temp) return result;
+
+    int min = (*temp).value1, max = (*temp).value1, length = 0, frequency = 0;
+    for (; temp; temp = mapped_next(temp)){
+        int v = (*temp).value1;
+        if (v < min) min = v;
+        if (v > max) max = v;
+        frequency += v == value;
+        length++;
+    }
+    if (which & AGGREGATE_MIN) result.min = min;
+    if (which & AGGREGATE_MAX) result.max = max;
+    if (which & AGGREGATE_LENGTH) result.length = length;
+    if (which & AGGREGATE_FREQUENCY) result.frequency = frequency;
+    return result;
+}
+
+
+/**
+ * @brief Changes the value of the first node of a writable list file with a value
+ * @details Only the page of the node is copied, the file is unchanged.
+ * Time complexity: O(n), n = number of nodes seen in the list
+ * @param m Pointer to the list opened as writable
+ * @param value The value of the node to be changed
+ * @param new_value The new value to be assigned to the node
+ * @return mnode* Pointer to the changed node.
+ * If the value is not found or the list is read only returns NULL
+ */
+mnode* mapped_change_node_value_with_value(mapped_list* m, int value, int new_value){
+    if (!m || !(*m).writable) return NULL;
+
+    mnode* n = mapped_value_in(m, value);
+    if (n) (*n).value1 = new_value;
+    return n;
+}
+
+
+/**
+ * @brief Removes the first node of a writable list file with a value
+ * @details The node before it gets the distance to the node after it (the node stays in the file, unused);
+ * only the changed pages are copied, the file is unchanged.
+ * Time complexity: O(n), n = number of nodes seen in the list
+ * @param m Pointer to the list opened as writable
+ * @param value The value of the node to be removed
+ * @return int 1 if a node is removed, 0 if the value is not found or the list is read only
+ */
+int mapped_remove_node_with_value(mapped_list* m, int value){
+    if (!m || !(*m).writable) return 0;
+
+    mnode* prev = NULL;
+    mnode* temp = mapped_first(m);
+    while (temp && (*temp).value1 != value){
+        prev = temp;
+        temp = mapped_next(temp);
+    }
+    if (!temp) return 0;
+
+    mnode* next = mapped_next(temp);
+    if (prev) (*prev).next = next ? (int32_t)(next - prev) : 0;
+    else (*(*m).header).head = next ? (int64_t)(next - (*m).nodes) : -1;
+    (*(*m).header).length--;
+    return 1;
+}
+
+
+/**
+ * @brief Creates a linked list with the values of a list file
+ * @details With an arena the nodes are consecutive nodes of one slab, otherwise one malloc for each node.
+ * Time complexity: O(n), n = number of nodes in the list
+ * @warning If memory allocation fails prints an error and exit program
+ * @param m Pointer to the opened list
+ * @param a Pointer to the arena for the nodes, NULL to allocate them with malloc
+ * @return linked_list The new linked list
+ */
+linked_list mapped_to_linked_list(mapped_list* m, arena* a){
+    linked_list l = {NULL, NULL, 0};
+    unsigned long long length = mapped_length(m);
+    if (length == 0) return l;
+
+    int* values = (int*)malloc(length * sizeof(int));
+    if (!values) {
+        printf("Memory allocation failed\n");
+        exit(EXIT_FAILURE); // critical error
+    }
+    unsigned int i = 0;
+    for (mnode* temp = mapped_first(m); temp; temp = mapped_next(temp)) values[i++] = (*temp).value1;
+
+    l.head = a ? arena_create_list(a, values, i) : create_list(values, i);
+    l.tail = a ? l.head + (i - 1) : l.head;
+    if (!a) while ((*l.tail).next) l.tail = (*l.tail).next;
+    l.length = i;
+    free(values);
+    return l;
+}
+
+
+
+
+// :::::::::::::::::::::::::::::::::::::::::::::::::: BENCHMARKS :::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+/**
+ * @brief Compares opening a saved list with loading it in a linked list
+ * @details Saves n values (random, 0 every 16 nodes) as a list file and as a raw array of values.
+ * Prints the time of: mapped_open and the first search of 0 on the mapping;
+ * reading the array and linked_list_create (one malloc for each node) and the first search of 0;
+ * a copy on write change (with at least 2 nodes), and checks that the file is unchanged and the results are the same.
+ * Time complexity: O(n)
+ * @warning If memory allocation fails prints an error and exit program
+ * @param n Number of nodes of the list
+ * @param path Path of the list file (the array is saved in path with ".values" appended), both are removed
+ * @return int 1 if the results are the same, 0 otherwise
+ */
+int benchmark_mapped(unsigned int n, const char* path){
+    int* values = benchmark_values(n);
+    srand(12345);
+    for (unsigned int i = 0; i < n; i++) values[i] = i % 16 ? rand() % 1000 + 1 : 0;
+    char values_path[4096];
+    snprintf(values_path, sizeof(values_path), "%s.values", path);
+
+    arena* a = create_arena(0);
+    node* head = arena_create_list(a, values, n);
+    double start = wall_seconds();
+    int ok = mapped_save_list(head, path);
+    double save = wall_seconds() - start;
+    clear_arena(a);
+    FILE* f = fopen(values_path, "wb");
+    ok = ok && f && fwrite(values, sizeof(int), n, f) == n;
+    if (f) ok = fclose(f) == 0 && ok;
+    if (!ok){
+        printf("could not write %s\n", path);
+        free(values);
+        return 0;
+    }
+
+    start = wall_seconds();
+    mapped_list m = mapped_open(path, 0);
+    double open_time = wall_seconds() - start;
+    unsigned long long mapped_zeros = mapped_count_frequents(&m, 0);
+    double mapped_first_pass = wall_seconds() - start;
+
+    start = wall_seconds();
+    f = fopen(values_path, "rb");
+    int* loaded = (int*)malloc((n ? n : 1) * sizeof(int));
+    if (!loaded) {
+        printf("Memory allocation failed\n");
+        exit(EXIT_FAILURE); // critical error
+    }
+    ok = f && fread(loaded, sizeof(int), n, f) == n;
+    if (f) fclose(f);
+    linked_list l = linked_list_create(loaded, n);
+    double load = wall_seconds() - start;
+    unsigned long long list_zeros = (unsigned long long)linked_list_count_frequents(&l, 0);
+    double list_first_pass = wall_seconds() - start;
+
+    aggregates mapped = mapped_aggregate(&m, AGGREGATE_ALL, 0);
+    aggregates list = aggregate_list(l.head, AGGREGATE_ALL, 0);
+    ok = ok && m.base && mapped_zeros == list_zeros && mapped_length(&m) == l.length
+         && mapped.min == list.min && mapped.max == list.max && mapped.frequency == list.frequency;
+    printf("%u nodes, file %.1f MB saved in %.3f s\n", n, (double)m.size / 1e6, save);
+    printf("open: mapped %.3f ms (first search %.3f ms), array + linked_list_create %.3f ms (first search %.3f ms)\n",
+           open_time * 1e3, mapped_first_pass * 1e3, load * 1e3, list_first_pass * 1e3);
+    mapped_close(&m);
+
+    if (n < 2){ // no node to change after the removed one
+        linked_list_clear(&l);
+        free(loaded);
+        free(values);
+        remove(path);
+        remove(values_path);
+        return ok;
+    }
+    mapped_list cow = mapped_open(path, 1);
+    start = wall_seconds();
+    int removed = mapped_remove_node_with_value(&cow, 0) && mapped_change_node_value_with_value(&cow, values[1], -1);
+    double change = wall_seconds() - start;
+    m = mapped_open(path, 0);
+    ok = ok && removed && mapped_length(&cow) + 1 == mapped_length(&m) && mapped_count_frequents(&m, -1) == 0
+         && mapped_count_frequents(&cow, -1) == 1;
+    printf("copy on write remove and change: %.3f ms, file unchanged%s\n", change * 1e3, ok ? "" : " (DIFFERENT RESULTS)");
+    mapped_close(&cow);
+    mapped_close(&m);
+
+    linked_list_clear(&l);
+    free(loaded);
+    free(values);
+    remove(path);
+    remove(values_path);
+    return ok;
+}
+
+
+
+
+// :::::::::::::::::::::::::::::::::::::::::::::::::::::: TESTS ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+/**
+ * @brief Entry point of the program, used for testing
+ * @details Runs the mapped list benchmark
+ * (the optional arguments are the number of nodes, default 10000000, and the path of the file, default mappedList.bin).
+ * @return 0 on successful execution, 1 if the results are different
+ */
+int main(int argc, char* argv[]){
+    unsigned int n = argc > 1 ? (unsigned int)strtoul(argv[1], NULL, 10) : 10000000;
+    const char* path = argc > 2 ? argv[2] : "mappedList.bin";
+    return benchmark_mapped(n, path) ? 0 : 1;
+
+    /* compiling: gcc mappedList.c -o mappedList -lpthread
+    executing: mappedList [nodes [path]] */
+}
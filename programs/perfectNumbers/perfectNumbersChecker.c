@@ -0,0 +1,992 @@
+/* :::::::::::::::::::::::::::::::::::::::::::::: MATH SOURCES :::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+perfect numbers definition:       https://en.wikipedia.org/wiki/Perfect_number
+multiperfect numbers:             https://en.wikipedia.org/wiki/Multiply_perfect_number
+    n is k-perfect <=> sigma(n) = k*n (perfect numbers are the 2-perfect numbers)
+    examples:
+        120 is 3-perfect (sigma(120) = 360)
+        30 240 is 4-perfect (sigma(30 240) = 120 960)
+divisor function:                 https://en.wikipedia.org/wiki/Divisor_function
+    sigma(p1^e1 * ... * pk^ek) = (p1^(e1+1)-1)/(p1-1) * ... * (pk^(ek+1)-1)/(pk-1)
+
+factoring algorithms:
+    trial division:               https://en.wikipedia.org/wiki/Trial_division
+    Pollard's rho (Brent):        https://en.wikipedia.org/wiki/Pollard%27s_rho_algorithm#Variants
+    Pollard's p-1:                https://en.wikipedia.org/wiki/Pollard%27s_p_%E2%88%92_1_algorithm
+    Lenstra's ECM:                https://en.wikipedia.org/wiki/Lenstra_elliptic-curve_factorization
+    Montgomery curves:            https://en.wikipedia.org/wiki/Montgomery_curve
+    Suyama's parametrization and the choice of B1: https://gitlab.inria.fr/zimmerma/ecm */
+
+/* :::::::::::::::::::::::::::::::::::::::::::::::: C SOURCES ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+threads:
+    https://man7.org/linux/man-pages/man7/pthreads.7.html
+    https://www.geeksforgeeks.org/multithreading-in-c
+
+time:
+    https://en.cppreference.com/w/c/chrono/timespec_get
+
+GNU (Multiple Precision Arithmetic Library):
+    https://gmplib.org
+    https://gmplib.org/gmp-man-6.3.0.pdf */
+
+
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::: LIBRARIES :::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+/**
+ * @file perfectNumbersChecker.c
+ * @author Lorenzo Mercuri
+ * @version 1.0
+ * @brief Checks if big integers are perfect or multiperfect
+ * @details Factors the numbers (trial division, Pollard's rho, p-1 and ECM),
+ * computes sigma(n) and compares it with n.
+ * Look at the sources at the begging of the file
+ */
+#include <stdio.h>
+#include <time.h>
+#include <stdlib.h> // for dynamic memory allocation
+#include <pthread.h> // ECM curves run in parallel
+#include <gmp.h> // Multiple Precision Arithmetic Library
+
+#define TRIAL_LIMIT 100000 // primes tested by trial division
+#define RHO_LIMIT 262144 // iterations of Pollard's rho before moving to p-1
+#define PM1_B1 100000
+#define PM1_B2 5000000
+#define MAX_B2 50000000UL // bounds the sieve used by the second stages
+#define DEFAULT_THREADS 4
+
+
+
+// :::::::::::::::::::::::::::::::::::::::::::::::::::: FACTORS ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+/**
+ * @struct node
+ * @brief Represent a node of a linked list of factors
+ * @details It has an mpz_t value for storing the prime factor,
+ * an unsigned long value for storing its exponent
+ * and a pointer to the next node in the list.
+ * Time complexity: O(1)
+ */
+typedef struct node{
+    mpz_t value1;
+    unsigned long value2;
+    struct node* next;
+} node;
+
+
+/**
+ * @struct stage_times
+ * @brief Seconds spent in each factoring stage
+ * @details Time complexity: O(1)
+ */
+typedef struct{
+    double trial_division;
+    double rho;
+    double pm1;
+    double ecm;
+    unsigned long curves; // ECM curves run
+} stage_times;
+
+
+/**
+ * @brief Create a new node
+ * @details Dynamically allocates memory for a new node,
+ * initialize the values to the argument and the pointer to NULL.
+ * Time complexity: O(1)
+ * @warning If memory allocation fails prints an error and exit program.
+ * @param v1 The prime factor
+ * @param v2 The exponent of the factor
+ * @return node* Pointer to the new node
+ */
+node* create_node(const mpz_t v1, unsigned long v2){
+    node* new_node = (node*)malloc(sizeof(node)); // dynamic allocation for the new node
+    if (!new_node) {
+        printf("Memory allocation failed\n");
+        exit(EXIT_FAILURE); // critical error
+    }
+
+    mpz_init_set((*new_node).value1, v1);
+    (*new_node).value2 = v2;
+    (*new_node).next = NULL;
+    return new_node;
+}
+
+
+/**
+ * @brief Adds a prime factor to a sorted list of factors
+ * @details If the prime is already in the list its exponent is increased,
+ * otherwise a new node is inserted keeping the list sorted.
+ * Time complexity: O(n), n = number of nodes in the list
+ * @param head Pointer to the head of the linked list
+ * @param prime The prime factor
+ * @param exponent The exponent to add
+ * @return node* Pointer to the head of the modified linked list
+ */
+node* insertion_factor(node* head, const mpz_t prime, unsigned long exponent){
+    if (!head || mpz_cmp(prime, (*head).value1) < 0){
+        node* n = create_node(prime, exponent);
+        (*n).next = head;
+        return n;
+    }
+
+    node* temp = head;
+    while ((*temp).next && mpz_cmp((*(*temp).next).value1, prime) <= 0) temp = (*temp).next;
+    if (mpz_cmp((*temp).value1, prime) == 0){
+        (*temp).value2 += exponent;
+        return head;
+    }
+
+    node* n = create_node(prime, exponent);
+    (*n).next = (*temp).next;
+    (*temp).next = n;
+    return head;
+}
+
+
+/**
+ * @brief Prints the factorization
+ * @details Time complexity: O(n), n = number of nodes in the list
+ * @param head Pointer to the head of the linked list
+ * @return void Doesn't return a value
+ */
+void print_list(node* head){
+    node* temp = head;
+    while (temp){
+        if ((*temp).value2 > 1) gmp_printf("%Zd^%lu", (*temp).value1, (*temp).value2);
+        else gmp_printf("%Zd", (*temp).value1);
+        temp = (*temp).next;
+        if (temp) printf(" * ");
+    }
+    printf("\n");
+}
+
+
+/**
+ * @brief Frees the memory allocated for a linked list
+ * @details Clears the mpz_t value and deallocates each node's memory.
+ * Time complexity: O(n), n = number of nodes in the list
+ * @param head Pointer to the head of the list
+ * @return void Doesn't return a value
+ */
+void clear_list(node* head){
+    node* temp;
+    while (head){
+        temp = head;
+        head = (*head).next;
+        mpz_clear((*temp).value1);
+        free(temp); // deallocate memory
+    }
+}
+
+
+/**
+ * @brief Seconds from a fixed point in time
+ * @details Wall clock time (clock() would sum the time of every thread).
+ * Time complexity: O(1)
+ * @return double The seconds
+ */
+double seconds(){
+    struct timespec now;
+    timespec_get(&now, TIME_UTC);
+    return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+
+/**
+ * @brief Sieve of Eratosthenes
+ * @details Time complexity: O(m log log m), m = limit
+ * @warning If memory allocation fails prints an error and exit program
+ * @param limit The largest number to check
+ * @return char* Array where composite[i] is 1 if i is not prime (to be freed by the caller)
+ */
+char* sieve(unsigned long limit){
+    char* composite = (char*)calloc(limit + 1, sizeof(char));
+    if (!composite) {
+        printf("Memory allocation failed\n");
+        exit(EXIT_FAILURE); // critical error
+    }
+
+    composite[0] = 1;
+    if (limit >= 1) composite[1] = 1;
+    for (unsigned long i = 2; i <= limit / i; i++){
+        if (composite[i]) continue;
+        for (unsigned long j = i * i; j <= limit; j += i) composite[j] = 1;
+    }
+    return composite;
+}
+
+
+
+// :::::::::::::::::::::::::::::::::::::::::::::::: TRIAL_DIVISION :::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+/**
+ * @brief Removes the small prime factors of a number
+ * @details Divides n by every prime up to TRIAL_LIMIT.
+ * Time complexity: O(TRIAL_LIMIT / log(TRIAL_LIMIT) * m), m = digits of n
+ * @param head Pointer to the head of the list of factors
+ * @param n The number, overwritten with the cofactor without small factors
+ * @return node* Pointer to the head of the list with the small factors added
+ */
+node* trial_division(node* head, mpz_t n){
+    char* composite = sieve(TRIAL_LIMIT);
+    mpz_t prime;
+    mpz_init(prime);
+
+    for (unsigned long p = 2; p <= TRIAL_LIMIT && mpz_cmp_ui(n, 1) > 0; p++){
+        if (composite[p] || !mpz_divisible_ui_p(n, p)) continue;
+
+        unsigned long exponent = 0;
+        while (mpz_divisible_ui_p(n, p)){
+            mpz_divexact_ui(n, n, p);
+            exponent++;
+        }
+        mpz_set_ui(prime, p);
+        head = insertion_factor(head, prime, exponent);
+    }
+
+    mpz_clear(prime);
+    free(composite);
+    return head;
+}
+
+
+
+// :::::::::::::::::::::::::::::::::::::::::::::::::: POLLARD_RHO ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+/**
+ * @brief Pollard's rho with Brent's cycle detection
+ * @details Iterates x = x^2 + c mod n, the products of |x - y| are accumulated
+ * so that a gcd is computed every 128 iterations.
+ * Finds factors up to ~10^12 in a fraction of a second.
+ * Time complexity: O(sqrt(q) * m^2), q = smallest prime factor of n, m = digits of n
+ * @param factor Preinitialized, set to the factor found
+ * @param n The composite number to factor
+ * @param c The constant of the polynomial
+ * @return int 1 if a proper factor is found, otherwise 0
+ */
+int pollard_rho_brent(mpz_t factor, const mpz_t n, unsigned long c){
+    const unsigned long m = 128;
+    mpz_t x, y, ys, q, diff;
+    mpz_inits(x, y, ys, q, diff, NULL);
+    mpz_set_ui(y, 2);
+    mpz_set_ui(q, 1);
+    mpz_set_ui(factor, 1);
+
+    for (unsigned long r = 1; mpz_cmp_ui(factor, 1) == 0 && r <= RHO_LIMIT; r *= 2){
+        mpz_set(x, y);
+        for (unsigned long i = 0; i < r; i++){
+            mpz_mul(y, y, y);
+            mpz_add_ui(y, y, c);
+            mpz_mod(y, y, n);
+        }
+
+        for (unsigned long k = 0; k < r && mpz_cmp_ui(factor, 1) == 0; k += m){
+            mpz_set(ys, y); // saved to backtrack if the gcd is n
+            for (unsigned long i = 0; i < m && i < r - k; i++){
+                mpz_mul(y, y, y);
+                mpz_add_ui(y, y, c);
+                mpz_mod(y, y, n);
+                mpz_sub(diff, x, y);
+                mpz_abs(diff, diff);
+                mpz_mul(q, q, diff);
+                mpz_mod(q, q, n);
+            }
+            mpz_gcd(factor, q, n);
+        }
+    }
+
+    if (mpz_cmp(factor, n) == 0){ // more factors found together, repeat one step at a time
+        do {
+            mpz_mul(ys, ys, ys);
+            mpz_add_ui(ys, ys, c);
+            mpz_mod(ys, ys, n);
+            mpz_sub(diff, x, ys);
+            mpz_abs(diff, diff);
+            mpz_gcd(factor, diff, n);
+        } while (mpz_cmp_ui(factor, 1) == 0);
+    }
+
+    mpz_clears(x, y, ys, q, diff, NULL);
+    return mpz_cmp_ui(factor, 1) > 0 && mpz_cmp(factor, n) < 0;
+}
+
+
+
+// :::::::::::::::::::::::::::::::::::::::::::::::::::::: P-1 ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+/**
+ * @brief Pollard's p-1
+ * @details Stage 1 computes a = 2^E mod n, E = product of the prime powers up to B1.
+ * Stage 2 extends it to one extra prime between B1 and B2.
+ * Finds a factor q when q-1 is B1-smooth (apart from one prime up to B2).
+ * Time complexity: O((B1 + B2 / log B2) * m^2), m = digits of n
+ * @param factor Preinitialized, set to the factor found
+ * @param n The composite number to factor
+ * @param B1 Bound of the first stage
+ * @param B2 Bound of the second stage
+ * @return int 1 if a proper factor is found, otherwise 0
+ */
+int p_minus_1(mpz_t factor, const mpz_t n, unsigned long B1, unsigned long B2){
+    if (B2 > MAX_B2) B2 = MAX_B2;
+    if (B2 < B1) B2 = B1;
+
+    char* composite = sieve(B2);
+    mpz_t a, x, acc, tmp;
+    mpz_inits(a, x, acc, tmp, NULL);
+    mpz_set_ui(a, 2);
+
+    // stage 1: the exponent is applied in word sized chunks
+    unsigned long long chunk = 1;
+    for (unsigned long p = 2; p <= B1; p++){
+        if (composite[p]) continue;
+        unsigned long long power = p;
+        while (power <= B1 / p) power *= p; // largest power <= B1
+        if (chunk > ~0ULL / power){
+            mpz_powm_ui(a, a, chunk, n);
+            chunk = 1;
+        }
+        chunk *= power;
+    }
+    mpz_powm_ui(a, a, chunk, n);
+    mpz_sub_ui(tmp, a, 1);
+    mpz_gcd(factor, tmp, n);
+    int found = mpz_cmp_ui(factor, 1) > 0 && mpz_cmp(factor, n) < 0;
+
+    // stage 2: x walks a^q for each prime q in (B1, B2], acc collects the product of (x-1)
+    if (!found && mpz_cmp_ui(factor, 1) == 0){
+        mpz_t gaps[128]; // gaps[g/2] = a^g, prime gaps are even
+        for (int g = 0; g < 128; g++) mpz_init(gaps[g]);
+        mpz_mul(gaps[1], a, a);
+        mpz_mod(gaps[1], gaps[1], n);
+        for (int g = 2; g < 128; g++){
+            mpz_mul(gaps[g], gaps[g - 1], gaps[1]);
+            mpz_mod(gaps[g], gaps[g], n);
+        }
+
+        unsigned long q = B1 + 1;
+        while (q <= B2 && composite[q]) q++;
+        mpz_powm_ui(x, a, q, n);
+        mpz_set_ui(acc, 1);
+        while (q <= B2){
+            mpz_sub_ui(tmp, x, 1);
+            mpz_mul(acc, acc, tmp);
+            mpz_mod(acc, acc, n);
+
+            unsigned long next = q + 1;
+            while (next <= B2 && composite[next]) next++;
+            if (next > B2) break;
+            unsigned long gap = next - q;
+            if (gap / 2 < 128) mpz_mul(x, x, gaps[gap / 2]);
+            else {
+                mpz_powm_ui(tmp, a, gap, n);
+                mpz_mul(x, x, tmp);
+            }
+            mpz_mod(x, x, n);
+            q = next;
+        }
+        mpz_gcd(factor, acc, n);
+        found = mpz_cmp_ui(factor, 1) > 0 && mpz_cmp(factor, n) < 0;
+
+        for (int g = 0; g < 128; g++) mpz_clear(gaps[g]);
+    }
+
+    mpz_clears(a, x, acc, tmp, NULL);
+    free(composite);
+    return found;
+}
+
+
+
+// :::::::::::::::::::::::::::::::::::::::::::::::::::::: ECM ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+#define ECM_D 210 // giant step of stage 2 (2*3*5*7)
+
+/**
+ * @struct ecm_level
+ * @brief B1 and number of curves expected to find a factor with a given number of digits
+ * @details Time complexity: O(1)
+ */
+typedef struct{
+    unsigned int digits;
+    unsigned long B1;
+    unsigned long curves;
+} ecm_level;
+
+const ecm_level ECM_LEVELS[] = {
+    {15, 2000, 25}, {20, 11000, 90}, {25, 50000, 300}, {30, 250000, 700}, {35, 1000000, 1800}, {40, 3000000, 5100}
+};
+const int ECM_LEVELS_COUNT = sizeof(ECM_LEVELS) / sizeof(ECM_LEVELS[0]);
+
+
+/**
+ * @struct ecm_job
+ * @brief Curves of an ECM level shared between the threads
+ * @details The threads take the next curve under the lock and stop when a factor is found.
+ * Time complexity: O(1)
+ */
+typedef struct{
+    mpz_srcptr n;
+    unsigned long B1;
+    unsigned long B2;
+    const char* composite; // sieve up to B2 + ECM_D
+    unsigned long curves;
+    unsigned long next_curve;
+    unsigned long done_curves;
+    int found;
+    mpz_t factor;
+    pthread_mutex_t lock;
+} ecm_job;
+
+
+/**
+ * @brief Doubles a point of a Montgomery curve
+ * @details x-only projective coordinates, a24 = (A+2)/4.
+ * Time complexity: O(m^2), m = digits of n
+ * @param x Preinitialized, set to the X coordinate of the result
+ * @param z Preinitialized, set to the Z coordinate of the result
+ * @param px X coordinate of the point
+ * @param pz Z coordinate of the point
+ * @param a24 Constant of the curve
+ * @param n The modulus
+ * @param t Array of 3 preinitialized temporaries
+ * @return void Doesn't return a value
+ */
+void ecm_double(mpz_t x, mpz_t z, const mpz_t px, const mpz_t pz, const mpz_t a24, const mpz_t n, mpz_t t[3]){
+    mpz_add(t[0], px, pz);
+    mpz_mul(t[0], t[0], t[0]); // (X+Z)^2
+    mpz_sub(t[1], px, pz);
+    mpz_mul(t[1], t[1], t[1]); // (X-Z)^2
+    mpz_sub(t[2], t[0], t[1]); // 4XZ
+    mpz_mul(x, t[0], t[1]);
+    mpz_mod(x, x, n);
+    mpz_mul(z, t[2], a24);
+    mpz_add(z, z, t[1]);
+    mpz_mul(z, z, t[2]);
+    mpz_mod(z, z, n);
+}
+
+
+/**
+ * @brief Adds two points of a Montgomery curve knowing their difference
+ * @details x-only projective coordinates (differential addition).
+ * Time complexity: O(m^2), m = digits of n
+ * @param x Preinitialized, set to the X coordinate of P+Q
+ * @param z Preinitialized, set to the Z coordinate of P+Q
+ * @param px X coordinate of P
+ * @param pz Z coordinate of P
+ * @param qx X coordinate of Q
+ * @param qz Z coordinate of Q
+ * @param dx X coordinate of P-Q
+ * @param dz Z coordinate of P-Q
+ * @param n The modulus
+ * @param t Array of 3 preinitialized temporaries
+ * @return void Doesn't return a value
+ */
+void ecm_add(mpz_t x, mpz_t z, const mpz_t px, const mpz_t pz, const mpz_t qx, const mpz_t qz,
+             const mpz_t dx, const mpz_t dz, const mpz_t n, mpz_t t[3]){
+    mpz_sub(t[0], px, pz);
+    mpz_add(t[1], qx, qz);
+    mpz_mul(t[0], t[0], t[1]); // (Xp-Zp)(Xq+Zq)
+    mpz_add(t[1], px, pz);
+    mpz_sub(t[2], qx, qz);
+    mpz_mul(t[1], t[1], t[2]); // (Xp+Zp)(Xq-Zq)
+    mpz_add(t[2], t[0], t[1]);
+    mpz_sub(t[1], t[0], t[1]);
+    mpz_mul(t[2], t[2], t[2]);
+    mpz_mul(t[1], t[1], t[1]);
+    mpz_mul(t[2], t[2], dz); // x and z can alias the inputs only after this point
+    mpz_mul(t[1], t[1], dx);
+    mpz_mod(x, t[2], n);
+    mpz_mod(z, t[1], n);
+}
+
+
+/**
+ * @brief Multiplies a point of a Montgomery curve by a scalar
+ * @details Montgomery ladder, the point is overwritten.
+ * Time complexity: O(log k * m^2), m = digits of n
+ * @param x X coordinate of the point, overwritten with the result
+ * @param z Z coordinate of the point, overwritten with the result
+ * @param k The scalar (at least 1)
+ * @param a24 Constant of the curve
+ * @param n The modulus
+ * @param t Array of 7 preinitialized temporaries
+ * @return void Doesn't return a value
+ */
+void ecm_multiply(mpz_t x, mpz_t z, unsigned long long k, const mpz_t a24, const mpz_t n, mpz_t t[7]){
+    if (k == 1) return;
+
+    mpz_ptr x0 = t[3], z0 = t[4], x1 = t[5], z1 = t[6];
+    mpz_set(x0, x);
+    mpz_set(z0, z);
+    ecm_double(x1, z1, x, z, a24, n, t);
+
+    int bit = 63;
+    while (!((k >> bit) & 1)) bit--;
+    for (bit--; bit >= 0; bit--){
+        if ((k >> bit) & 1){
+            ecm_add(x0, z0, x1, z1, x0, z0, x, z, n, t);
+            ecm_double(x1, z1, x1, z1, a24, n, t);
+        } else {
+            ecm_add(x1, z1, x1, z1, x0, z0, x, z, n, t);
+            ecm_double(x0, z0, x0, z0, a24, n, t);
+        }
+    }
+    mpz_set(x, x0);
+    mpz_set(z, z0);
+}
+
+
+/**
+ * @brief Runs one ECM curve
+ * @details The curve and its starting point come from Suyama's parametrization of sigma:
+ * u = sigma^2-5, v = 4sigma, x = u^3, z = v^3, a24 = (v-u)^3 (3u+v) / (16 u^3 v).
+ * Stage 1 multiplies the point by every prime power up to B1,
+ * stage 2 uses baby steps j*Q and giant steps k*ECM_D*Q to cover the primes k*ECM_D +- j up to B2.
+ * Time complexity: O((B1 + B2 / log B2) * m^2), m = digits of n
+ * @param factor Preinitialized, set to the factor found
+ * @param job The shared job (n, bounds and sieve)
+ * @param sigma The parameter of the curve (at least 6)
+ * @return int 1 if a proper factor is found, otherwise 0
+ */
+int ecm_curve(mpz_t factor, ecm_job* job, unsigned long sigma){
+    mpz_srcptr n = (*job).n;
+    unsigned long B1 = (*job).B1, B2 = (*job).B2;
+    const char* composite = (*job).composite;
+
+    mpz_t u, v, x, z, a24, acc, t[7];
+    mpz_inits(u, v, x, z, a24, acc, NULL);
+    for (int i = 0; i < 7; i++) mpz_init(t[i]);
+
+    mpz_set_ui(u, sigma);
+    mpz_mul(u, u, u);
+    mpz_sub_ui(u, u, 5);
+    mpz_set_ui(v, 4 * sigma);
+    mpz_powm_ui(x, u, 3, n);
+    mpz_powm_ui(z, v, 3, n);
+
+    mpz_sub(t[0], v, u);
+    mpz_powm_ui(t[0], t[0], 3, n);
+    mpz_mul_ui(t[1], u, 3);
+    mpz_add(t[1], t[1], v);
+    mpz_mul(a24, t[0], t[1]); // (v-u)^3 (3u+v)
+    mpz_mul_ui(t[2], x, 16);
+    mpz_mul(t[2], t[2], v); // 16 u^3 v
+    mpz_mod(t[2], t[2], n);
+
+    int found = 0;
+    if (!mpz_invert(t[3], t[2], n)){ // the denominator shares a factor with n
+        mpz_gcd(factor, t[2], n);
+        found = mpz_cmp_ui(factor, 1) > 0 && mpz_cmp(factor, n) < 0;
+        goto end;
+    }
+    mpz_mul(a24, a24, t[3]);
+    mpz_mod(a24, a24, n);
+
+    // stage 1
+    for (unsigned long p = 2; p <= B1; p++){
+        if (composite[p]) continue;
+        unsigned long long power = p;
+        while (power <= B1 / p) power *= p; // largest power <= B1
+        ecm_multiply(x, z, power, a24, n, t);
+    }
+    mpz_gcd(factor, z, n);
+    if (mpz_cmp_ui(factor, 1) != 0){
+        found = mpz_cmp(factor, n) < 0;
+        goto end;
+    }
+
+    // stage 2: baby steps j*Q, j odd and coprime with ECM_D, up to ECM_D/2
+    {
+        mpz_t baby_x[ECM_D / 2], baby_z[ECM_D / 2];
+        mpz_t qx2, qz2, gx, gz, dx, dz, rx, rz, sx, sz;
+        mpz_inits(qx2, qz2, gx, gz, dx, dz, rx, rz, sx, sz, NULL);
+        for (int j = 0; j < ECM_D / 2; j++) mpz_inits(baby_x[j], baby_z[j], NULL);
+
+        mpz_set(baby_x[1], x);
+        mpz_set(baby_z[1], z);
+        ecm_double(qx2, qz2, x, z, a24, n, t); // 2Q
+        ecm_add(baby_x[3], baby_z[3], qx2, qz2, x, z, x, z, n, t); // 3Q = 2Q + Q
+        for (int j = 5; j < ECM_D / 2; j += 2) // (j)Q = (j-2)Q + 2Q
+            ecm_add(baby_x[j], baby_z[j], baby_x[j - 2], baby_z[j - 2], qx2, qz2, baby_x[j - 4], baby_z[j - 4], n, t);
+
+        // giant steps: r = k*D*Q, s = (k-1)*D*Q
+        mpz_set(gx, x);
+        mpz_set(gz, z);
+        ecm_multiply(gx, gz, ECM_D, a24, n, t); // D*Q
+        unsigned long k = B1 / ECM_D > 1 ? B1 / ECM_D : 1;
+        mpz_set(rx, x);
+        mpz_set(rz, z);
+        ecm_multiply(rx, rz, (unsigned long long)k * ECM_D, a24, n, t);
+        mpz_set(sx, x);
+        mpz_set(sz, z);
+        if (k > 1) ecm_multiply(sx, sz, (unsigned long long)(k - 1) * ECM_D, a24, n, t);
+
+        mpz_set_ui(acc, 1);
+        for (; k * ECM_D - ECM_D / 2 <= B2; k++){
+            for (int j = 1; j < ECM_D / 2; j += 2){
+                unsigned long low = k * ECM_D - j, high = k * ECM_D + j;
+                int useful = (low > B1 && low <= B2 && !composite[low]) || (high > B1 && high <= B2 && !composite[high]);
+                if (!useful) continue;
+
+                mpz_mul(t[0], rx, baby_z[j]);
+                mpz_mul(t[1], baby_x[j], rz);
+                mpz_sub(t[0], t[0], t[1]);
+                mpz_mul(acc, acc, t[0]);
+                mpz_mod(acc, acc, n);
+            }
+            if (k == 1) ecm_double(dx, dz, rx, rz, a24, n, t); // 2*D*Q
+            else ecm_add(dx, dz, rx, rz, gx, gz, sx, sz, n, t); // (k+1)*D*Q
+            mpz_swap(sx, rx);
+            mpz_swap(sz, rz);
+            mpz_swap(rx, dx);
+            mpz_swap(rz, dz);
+        }
+        mpz_gcd(factor, acc, n);
+        found = mpz_cmp_ui(factor, 1) > 0 && mpz_cmp(factor, n) < 0;
+
+        for (int j = 0; j < ECM_D / 2; j++) mpz_clears(baby_x[j], baby_z[j], NULL);
+        mpz_clears(qx2, qz2, gx, gz, dx, dz, rx, rz, sx, sz, NULL);
+    }
+
+end:
+    mpz_clears(u, v, x, z, a24, acc, NULL);
+    for (int i = 0; i < 7; i++) mpz_clear(t[i]);
+    return found;
+}
+
+
+/**
+ * @brief Thread running ECM curves
+ * @details Takes the next curve of the job until the curves are over or a factor is found.
+ * Time complexity: O(curves / threads * curve time)
+ * @param arg Pointer to the shared ecm_job
+ * @return void* NULL
+ */
+void* ecm_worker(void* arg){
+    ecm_job* job = (ecm_job*)arg;
+    mpz_t factor;
+    mpz_init(factor);
+
+    while (1){
+        pthread_mutex_lock(&(*job).lock);
+        if ((*job).found || (*job).next_curve >= (*job).curves){
+            pthread_mutex_unlock(&(*job).lock);
+            break;
+        }
+        unsigned long sigma = 6 + (*job).B1 + (*job).next_curve++; // different curves for each level
+        pthread_mutex_unlock(&(*job).lock);
+
+        int found = ecm_curve(factor, job, sigma);
+
+        pthread_mutex_lock(&(*job).lock);
+        (*job).done_curves++;
+        if (found && !(*job).found){
+            mpz_set((*job).factor, factor);
+            (*job).found = 1;
+        }
+        pthread_mutex_unlock(&(*job).lock);
+    }
+
+    mpz_clear(factor);
+    return NULL;
+}
+
+
+/**
+ * @brief Lenstra's elliptic curve method on Montgomery curves
+ * @details Runs the levels of ECM_LEVELS (from 15 to 40 digits factors),
+ * the curves of each level are spread across the threads.
+ * Time complexity: O(curves * (B1 + B2 / log B2) * m^2 / threads), m = digits of n
+ * @param factor Preinitialized, set to the factor found
+ * @param n The composite number to factor
+ * @param threads Number of threads
+ * @param curves Pointer where the number of curves run is added
+ * @return int 1 if a proper factor is found, otherwise 0
+ */
+int ecm(mpz_t factor, const mpz_t n, int threads, unsigned long* curves){
+    pthread_t* ids = (pthread_t*)malloc(threads * sizeof(pthread_t));
+    if (!ids) {
+        printf("Memory allocation failed\n");
+        exit(EXIT_FAILURE); // critical error
+    }
+
+    int found = 0;
+    for (int level = 0; level < ECM_LEVELS_COUNT && !found; level++){
+        ecm_job job;
+        job.n = n;
+        job.B1 = ECM_LEVELS[level].B1;
+        job.B2 = 50 * job.B1 < MAX_B2 ? 50 * job.B1 : MAX_B2;
+        job.composite = sieve(job.B2 + ECM_D);
+        job.curves = ECM_LEVELS[level].curves;
+        job.next_curve = 0;
+        job.done_curves = 0;
+        job.found = 0;
+        mpz_init(job.factor);
+        pthread_mutex_init(&job.lock, NULL);
+
+        int started = 0;
+        for (; started < threads; started++) if (pthread_create(&ids[started], NULL, ecm_worker, &job)) break;
+        if (started == 0) ecm_worker(&job); // no thread available, runs the curves here
+        for (int i = 0; i < started; i++) pthread_join(ids[i], NULL);
+
+        found = job.found;
+        if (found) mpz_set(factor, job.factor);
+        *curves += job.done_curves;
+
+        pthread_mutex_destroy(&job.lock);
+        mpz_clear(job.factor);
+        free((char*)job.composite);
+    }
+
+    free(ids);
+    return found;
+}
+
+
+
+// :::::::::::::::::::::::::::::::::::::::::::::::: PERFECT_NUMBERS ::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+/**
+ * @brief Factors a number
+ * @details Trial division removes the small factors, then every composite cofactor goes through
+ * Pollard's rho, p-1 and ECM until it splits; perfect powers are split with integer roots.
+ * The seconds of each stage are added to times.
+ * Time complexity: depends on the second largest prime factor of n
+ * @param n The number to factor (positive)
+ * @param threads Number of threads used by ECM
+ * @param times Pointer where the seconds of each stage are added
+ * @param complete Pointer set to 1 if n is fully factored, 0 if a composite cofactor is left
+ * @return node* Pointer to the head of the sorted list of prime factors
+ */
+node* factor_number(const mpz_t n, int threads, stage_times* times, int* complete){
+    node* head = NULL;
+    *complete = 1;
+
+    mpz_t cofactor, factor, root;
+    mpz_inits(cofactor, factor, root, NULL);
+    mpz_set(cofactor, n);
+
+    double start = seconds();
+    head = trial_division(head, cofactor);
+    (*times).trial_division += seconds() - start;
+
+    // stack of the composites still to be split, each with its multiplicity
+    size_t size = 0, capacity = 16;
+    mpz_t* stack = (mpz_t*)malloc(capacity * sizeof(mpz_t));
+    unsigned long* multiplicity = (unsigned long*)malloc(capacity * sizeof(unsigned long));
+    if (!stack || !multiplicity) {
+        printf("Memory allocation failed\n");
+        exit(EXIT_FAILURE); // critical error
+    }
+    if (mpz_cmp_ui(cofactor, 1) > 0){
+        mpz_init_set(stack[size], cofactor);
+        multiplicity[size++] = 1;
+    }
+
+    while (size > 0){
+        size--;
+        mpz_t c;
+        mpz_init_set(c, stack[size]);
+        mpz_clear(stack[size]);
+        unsigned long e = multiplicity[size];
+
+        if (mpz_probab_prime_p(c, 25)){
+            head = insertion_factor(head, c, e);
+            mpz_clear(c);
+            continue;
+        }
+
+        int split = 0;
+        unsigned long power = 0;
+        if (mpz_perfect_power_p(c))
+            for (unsigned long k = 2; !power; k++) if (mpz_root(root, c, k)) power = k; // c = root^k
+        if (power){
+            mpz_set(factor, root);
+            mpz_set_ui(c, 1); // the cofactor is factor^(power-1), pushed with the factor
+            e *= power;
+            split = 1;
+        }
+
+        start = seconds();
+        for (unsigned long poly = 1; !split && poly <= 3; poly++){
+            split = pollard_rho_brent(factor, c, poly);
+            if (!split && mpz_cmp(factor, c) != 0) break; // iterations over, another polynomial wouldn't help
+        }
+        (*times).rho += seconds() - start;
+
+        if (!split){
+            start = seconds();
+            split = p_minus_1(factor, c, PM1_B1, PM1_B2);
+            (*times).pm1 += seconds() - start;
+        }
+
+        if (!split){
+            start = seconds();
+            split = ecm(factor, c, threads, &(*times).curves);
+            (*times).ecm += seconds() - start;
+        }
+
+        if (!split){ // factors above the ECM levels
+            *complete = 0;
+            head = insertion_factor(head, c, e);
+            mpz_clear(c);
+            continue;
+        }
+
+        if (size + 2 > capacity){
+            capacity *= 2;
+            stack = (mpz_t*)realloc(stack, capacity * sizeof(mpz_t));
+            multiplicity = (unsigned long*)realloc(multiplicity, capacity * sizeof(unsigned long));
+            if (!stack || !multiplicity) {
+                printf("Memory allocation failed\n");
+                exit(EXIT_FAILURE); // critical error
+            }
+        }
+        mpz_init_set(stack[size], factor);
+        multiplicity[size++] = e;
+        if (mpz_cmp_ui(c, 1) > 0){
+            mpz_init(stack[size]);
+            mpz_divexact(stack[size], c, factor);
+            multiplicity[size++] = e;
+        }
+        mpz_clear(c);
+    }
+
+    free(stack);
+    free(multiplicity);
+    mpz_clears(cofactor, factor, root, NULL);
+    return head;
+}
+
+
+/**
+ * @brief Computes the sum of the divisors of a number
+ * @details sigma(n) = product of (p^(e+1)-1)/(p-1) over the prime factors.
+ * Time complexity: O(k * m^2), k = number of prime factors, m = digits of n
+ * @param sigma Preinitialized, set to the result
+ * @param head Pointer to the head of the list of prime factors
+ * @return void Doesn't return a value
+ */
+void sigma_from_factors(mpz_t sigma, node* head){
+    mpz_t term;
+    mpz_init(term);
+    mpz_set_ui(sigma, 1);
+
+    node* temp = head;
+    while (temp){
+        mpz_pow_ui(term, (*temp).value1, (*temp).value2 + 1);
+        mpz_sub_ui(term, term, 1);
+        mpz_mul(sigma, sigma, term);
+        mpz_sub_ui(term, (*temp).value1, 1);
+        mpz_divexact(sigma, sigma, term);
+        temp = (*temp).next;
+    }
+    mpz_clear(term);
+}
+
+
+/**
+ * @brief Checks if a number is perfect or multiperfect
+ * @details Factors n, computes sigma(n) and prints the factorization,
+ * sigma(n), the classification and the seconds of each factoring stage.
+ * Time complexity: see factor_number
+ * @param n The number to check (positive)
+ * @param threads Number of threads used by ECM
+ * @return int k if n is k-perfect, 0 if it is not, -1 if it could not be fully factored
+ */
+int check_perfect_number(const mpz_t n, int threads){
+    stage_times times = {0, 0, 0, 0, 0};
+    int complete = 0;
+    double start = seconds();
+    node* factors = factor_number(n, threads, &times, &complete);
+    double total = seconds() - start;
+
+    gmp_printf("n = %Zd\n", n);
+    printf("factors: ");
+    print_list(factors);
+
+    int k = -1;
+    if (!complete) printf("result: unknown, a composite cofactor could not be split\n");
+    else {
+        mpz_t sigma, quotient;
+        mpz_inits(sigma, quotient, NULL);
+        sigma_from_factors(sigma, factors);
+        gmp_printf("sigma(n) = %Zd\n", sigma);
+
+        k = 0;
+        if (mpz_divisible_p(sigma, n)){
+            mpz_divexact(quotient, sigma, n);
+            k = mpz_fits_sint_p(quotient) ? (int)mpz_get_si(quotient) : 0;
+        }
+        if (k == 2) printf("result: perfect\n");
+        else if (k > 2) printf("result: %d-perfect\n", k);
+        else {
+            mpz_mul_2exp(quotient, n, 1);
+            printf("result: not perfect (%s)\n", mpz_cmp(sigma, quotient) > 0 ? "abundant" : "deficient");
+            k = 0;
+        }
+        mpz_clears(sigma, quotient, NULL);
+    }
+
+    printf("trial division: %.3fs, rho: %.3fs, p-1: %.3fs, ecm: %.3fs (%lu curves), total: %.3fs\n\n",
+           times.trial_division, times.rho, times.pm1, times.ecm, times.curves, total);
+    clear_list(factors);
+    return k;
+}
+
+
+/**
+ * @brief Checks every number of a file
+ * @details The numbers are written in base 10 and separated by spaces or new lines.
+ * Time complexity: see factor_number, for each number
+ * @param path Path of the input file
+ * @param threads Number of threads used by ECM
+ * @return int Number of numbers checked, -1 if the file can't be opened
+ */
+int check_perfect_numbers_file(const char* path, int threads){
+    FILE* file = fopen(path, "r");
+    if (!file) {
+        printf("Can't open %s\n", path);
+        return -1;
+    }
+
+    mpz_t n;
+    mpz_init(n);
+    int count = 0;
+    while (mpz_inp_str(n, file, 10) > 0){
+        if (mpz_sgn(n) <= 0) continue;
+        check_perfect_number(n, threads);
+        count++;
+    }
+    mpz_clear(n);
+    fclose(file);
+    return count;
+}
+
+
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::: TESTS :::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+/**
+ * @brief Entry point of the program
+ * @details With a file argument checks every number of the file (batch mode),
+ * otherwise prompts the user to enter a number.
+ * The optional second argument is the number of threads used by ECM.
+ * @warning Assumes valid user input
+ * @return 0 on successful execution
+ */
+int main(int argc, char* argv[]){
+    int threads = argc > 2 ? atoi(argv[2]) : DEFAULT_THREADS;
+    if (threads < 1) threads = 1;
+
+    if (argc > 1){
+        double start = seconds();
+        int count = check_perfect_numbers_file(argv[1], threads);
+        if (count < 0) return 1;
+        printf("%d numbers checked in %.3fs\n", count, seconds() - start);
+        return 0;
+    }
+
+    mpz_t n;
+    mpz_init(n);
+    printf("Number to check? ");
+    if (mpz_inp_str(n, stdin, 10) == 0 || mpz_sgn(n) <= 0) return 1;
+    check_perfect_number(n, threads);
+    mpz_clear(n);
+    return 0;
+
+    /* compiling: gcc perfectNumbersChecker.c -o perfectNumbersChecker -lgmp -lpthread
+    executing: perfectNumbersChecker [numbers.txt] [threads] */
+}
@@ -0,0 +1,907 @@
+/* :::::::::::::::::::::::::::::::::::::::::::::: MATH SOURCES :::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+perfect numbers definition:       https://en.wikipedia.org/wiki/Perfect_number
+every even perfect number:
+    - is a triangular number:     https://en.wikipedia.org/wiki/Triangular_number
+    - is an hexagonal number:     https://en.wikipedia.org/wiki/Hexagonal_number#:~:text=1%2C%206%2C%2015%2C%2028,.)%20is%20a%20hexagonal%20number.
+    - is a practical number:      https://en.wikipedia.org/wiki/Practical_number
+    - has a binary expression with p lenght ​​equal to one followed by p-1 zeros (p prime)
+        examples:
+            6 base 10 = 110 base 2
+            28 base 10 = 11100 base 2
+    
+Mersenne's theory:                https://en.wikipedia.org/wiki/Mersenne_prime
+Miller-Rabin:                     https://en.wikipedia.org/wiki/Miller%E2%80%93Rabin_primality_test
+Lucas-Lehmer:                     https://en.wikipedia.org/wiki/Lucas%E2%80%93Lehmer_primality_test
+factors of Mersenne's numbers:    https://www.mersenne.org/various/math.php
+    every factor q of 2^p-1 (p prime) has the form q = 2kp+1 and q = +-1 mod 8
+Pollard's p-1:                    https://en.wikipedia.org/wiki/Pollard%27s_p_%E2%88%92_1_algorithm
+Dickman function:                 https://en.wikipedia.org/wiki/Dickman_function
+list of perfect numbers:          https://en.wikipedia.org/wiki/List_of_Mersenne_primes_and_perfect_numbers
+    first 12 perfect numbers:
+    6
+    28
+    496
+    8 128
+    33 550 336 (8 digits)
+    8 589 869 056 (10 digits)
+    137 438 691 328 (12 digits)
+    2 305 843 008 139 952 128 (19 digits)
+    2 658 455 991 569 831 744 654 692 615 953 842 176 (37 digits)
+    191 561 942 608 236 107 294 793 378 084 303 638 130 997 321 548 169 216 (54 digits)
+    13 164 036 458 569 648 337 239 753 460 458 722 910 223 472 318 386 943 117 783 728 128 (65 digits)
+    14 474 011 154 664 524 427 946 373 126 085 988 481 573 677 491 474 835 889 066 354 349 131 199 152 128 (77 digits)
+
+    mpz_mul switch automatically to better algorithm for non galactic number (too big numbers)
+    (Karatsuba                    https://en.wikipedia.org/wiki/Karatsuba_algorithm, 
+    Toom-Cook                     https://en.wikipedia.org/wiki/Toom%E2%80%93Cook_multiplication and
+    Schönhage-Strassen            https://en.wikipedia.org/wiki/Sch%C3%B6nhage%E2%80%93Strassen_algorithm) */
+
+/* :::::::::::::::::::::::::::::::::::::::::::::::: C SOURCES ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+struct:
+    https://www.w3schools.com/c/c_structs.php
+
+time: 
+    https://www.geeksforgeeks.org/time_taken-h-header-file-in-c-with-examples
+    https://www.geeksforgeeks.org/how-to-measure-time_taken-taken-by-a-program-in-c
+
+linked list:
+    https://www.geeksforgeeks.org/linked-list-in-c
+    https://www.geeksforgeeks.org/insertion-in-linked-list
+    https://learn.microsoft.com/it-it/cpp/c-runtime-library/reference/malloc?view=msvc-170
+    https://learn.microsoft.com/it-it/cpp/c-runtime-library/reference/free?view=msvc-170
+    https://www.geeksforgeeks.org/understanding-time-complexity-simple-examples
+
+bitwise shifting:
+    https://www.geeksforgeeks.org/left-shift-right-shift-operators-c-cpp
+
+data types:
+    https://en.wikipedia.org/wiki/C_data_types 
+    
+GNU (Multiple Precision Arithmetic Library):
+There is no practical limit to the precision except the ones implied by the available memory in the machine GMP runs on
+    https://gmplib.org
+    https://en.wikipedia.org/wiki/GNU_Multiple_Precision_Arithmetic_Library 
+    https://gmplib.org/gmp-man-6.3.0.pdf
+    https://www.youtube.com/watch?v=xqUCz0Mt0Mo */
+
+
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::: LIBRARIES :::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+/**
+ * @file perfectNumbersV3.c
+ * @author Lorenzo Mercuri
+ * @version 3.0
+ * @brief Computes perfect numbers
+ * @details Look at the sources at the begging of the file.
+ * Each Mersenne's number goes through trial factoring, Pollard's p-1 and the Lucas-Lehmer test,
+ * the effort spent in the first two stages is chosen by a cost model calibrated on this machine
+ */
+#include <stdio.h>
+#include <time.h>
+#include <math.h>
+#include <stdlib.h> // for dynamic memory allocation
+#include <gmp.h> // Multiple Precision Arithmetic Library
+
+
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::: NODE ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+/**
+ * @struct node
+ * @brief Represent a node of a linked list
+ * @details It has mp_bitcnt_t value for storing the prime number,
+ * an usize_t value for storing the lenght of the perfect number,
+ * an mpz_t value for storing the perfect number
+ * and a pointer to the next node in the list.
+ * Time complexity: O(1)
+ */
+typedef struct node{
+    mp_bitcnt_t value1;
+    size_t value2;
+    mpz_t value3;
+    struct node* next;
+} node;
+
+
+/**
+ * @brief Create a new node
+ * @details Dynamically allocates memory for a new node,
+ * initialize the integer values to the argument and the pointer to NULL.
+ * Time complexity: O(1)
+ * @warning If memory allocation fails prints an error and exit program.
+ * @param v1 The mp_bitcnt_t value of the node
+ * @param v2 The size_t value of the node
+ * @param v3 The mpz_t value of the node
+ * @return node* Pointer to the new node
+ */
+node* create_node(mp_bitcnt_t v1, size_t v2, mpz_t v3){
+    node* new_node = (node*)malloc(sizeof(node)); // dynamic allocation for the new node
+    if (!new_node) {
+        printf("Memory allocation failed\n");
+        exit(EXIT_FAILURE); // critic error
+    }
+
+    // (*...) dereference
+    (*new_node).value1 = v1; // initialize
+    (*new_node).value2 = v2; // initialize
+    mpz_init((*new_node).value3); // initializes
+    mpz_set((*new_node).value3, v3); // sets value
+    (*new_node).next = NULL;
+    return new_node;
+}
+
+
+/**
+ * @brief Insert a node at the head of a linked list
+ * @details Takes a node and inserts it at the beginning of the list.
+ * Time complexity: O(1)
+ * @param head Pointer to the current head of the linked list
+ * @param n Pointer to the node to be inserted at the head
+ * @return node* Pointer to the new head of the linked list
+ */
+node* insertion_head_node(node* head, node* n){
+    (*n).next = head;
+    return n;
+}
+
+
+/**
+ * @brief Prints the values of each node of the linked list
+ * @details Time complexity: O(n), n = number of nodes in the list
+ * @param head Pointer to the head of the linked list
+ * @return void Doesn't return a value
+ */
+void print_list(node* head){
+    node* temp = head;
+    while(temp) {
+        gmp_printf("(prime: %lu\n digits: %zu\n perfect number: %Zd)\n\n", (*temp).value1, (*temp).value2, (*temp).value3); // prints
+        temp = (*temp).next;
+    }
+}
+
+
+
+// :::::::::::::::::::::::::::::::::::::::::::::::::::: PRIMES :::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+/**
+ * @brief Checks if an exponent is prime
+ * @details If p is composite then 2^p-1 is composite too, so composite exponents are skipped.
+ * Time complexity: O(sqrt(p))
+ * @param p The exponent to check
+ * @return 1 if the exponent is prime or 0 if it is not prime
+ */
+int is_prime_exponent(mp_bitcnt_t p){
+    if (p < 2) return 0;
+    if (p < 4) return 1;
+    if (p % 2 == 0) return 0;
+
+    for (mp_bitcnt_t i = 3; i * i <= p; i += 2) if (p % i == 0) return 0;
+    return 1;
+}
+
+
+/**
+ * @brief Computes every prime number up to a limit
+ * @details Uses the sieve of Eratosthenes.
+ * Time complexity: O(m log log m), m = limit
+ * @warning If memory allocation fails prints an error and exit program
+ * @param limit The largest number to check
+ * @param count Pointer where the number of primes found is stored
+ * @return unsigned long* Array of the primes in increasing order (to be freed by the caller)
+ */
+unsigned long* sieve_primes(unsigned long limit, size_t* count){
+    char* composite = (char*)calloc(limit + 1, sizeof(char));
+    unsigned long* primes = (unsigned long*)malloc((limit / 2 + 2) * sizeof(unsigned long));
+    if (!composite || !primes) {
+        printf("Memory allocation failed\n");
+        exit(EXIT_FAILURE); // critical error
+    }
+
+    *count = 0;
+    for (unsigned long i = 2; i <= limit; i++){
+        if (composite[i]) continue;
+        primes[(*count)++] = i;
+        if (i <= limit / i) for (unsigned long j = i * i; j <= limit; j += i) composite[j] = 1;
+    }
+    free(composite);
+    return primes;
+}
+
+
+
+// :::::::::::::::::::::::::::::::::::::::::::::::::::: STAGES :::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+#define MAX_TF_BITS 63 // factors are kept in an unsigned long long (2kp+1 must not overflow)
+#define MAX_B2 20000000UL // bounds the sieve used by the second stage of p-1
+
+/**
+ * @brief Reduces a non negative number modulo a Mersenne's number
+ * @details Uses 2^p = 1 (mod 2^p-1): the bits above p are added back to the lower p bits,
+ * so no division is needed.
+ * Time complexity: O(m), m = digits of r
+ * @param r The number to reduce, overwritten with the result
+ * @param tmp Preinitialized temporary
+ * @param p The exponent of the Mersenne's number
+ * @param mersenne The Mersenne's number 2^p-1
+ * @return void Doesn't return a value
+ */
+void mod_mersenne(mpz_t r, mpz_t tmp, mp_bitcnt_t p, const mpz_t mersenne){
+    while (mpz_sizeinbase(r, 2) > p){
+        mpz_tdiv_q_2exp(tmp, r, p); // tmp = r >> p
+        mpz_tdiv_r_2exp(r, r, p); // r = r & (2^p-1)
+        mpz_add(r, r, tmp);
+    }
+    if (mpz_cmp(r, mersenne) >= 0) mpz_sub(r, r, mersenne);
+}
+
+
+/**
+ * @brief Computes base^e modulo a Mersenne's number
+ * @details Left to right binary exponentiation, every product is reduced with mod_mersenne.
+ * Time complexity: O(log e * m^1.6), m = digits of the Mersenne's number
+ * @param r Preinitialized, set to the result (can be the same variable of base)
+ * @param base The base (less than 2^p-1)
+ * @param e The exponent
+ * @param p The exponent of the Mersenne's number
+ * @param mersenne The Mersenne's number 2^p-1
+ * @return void Doesn't return a value
+ */
+void pow_mersenne(mpz_t r, const mpz_t base, unsigned long long e, mp_bitcnt_t p, const mpz_t mersenne){
+    mpz_t b, tmp;
+    mpz_init_set(b, base);
+    mpz_init(tmp);
+    mpz_set_ui(r, 1);
+
+    int bit = 63;
+    while (bit >= 0 && !((e >> bit) & 1)) bit--;
+    for (; bit >= 0; bit--){
+        mpz_mul(r, r, r);
+        mod_mersenne(r, tmp, p, mersenne);
+        if ((e >> bit) & 1){
+            mpz_mul(r, r, b);
+            mod_mersenne(r, tmp, p, mersenne);
+        }
+    }
+    mpz_clears(b, tmp, NULL);
+}
+
+
+/**
+ * @brief Computes 2^p mod q
+ * @details Left to right binary exponentiation on 128 bits products.
+ * Time complexity: O(log p)
+ * @param p The exponent
+ * @param q The modulus (odd, less than 2^63)
+ * @return unsigned long long 2^p mod q
+ */
+unsigned long long pow2_mod(mp_bitcnt_t p, unsigned long long q){
+    unsigned __int128 result = 1;
+    int bit = 63;
+    while (bit >= 0 && !((p >> bit) & 1)) bit--;
+
+    for (; bit >= 0; bit--){
+        result = (result * result) % q;
+        if ((p >> bit) & 1) result = (result << 1) % q;
+    }
+    return (unsigned long long)result;
+}
+
+
+/**
+ * @brief Trial factoring of a Mersenne's number
+ * @details Tests every candidate q = 2kp+1 with from_bits <= log2(q) < to_bits.
+ * Candidates not equal to +-1 mod 8 or divisible by a small prime are skipped without testing.
+ * Time complexity: O(2^to_bits / p * log p)
+ * @param p The exponent of the Mersenne's number
+ * @param from_bits Candidates below 2^from_bits are considered already tested
+ * @param to_bits Candidates from 2^to_bits are not tested (at most MAX_TF_BITS)
+ * @return unsigned long long The first factor found, 0 if there is no factor in the range
+ */
+unsigned long long trial_factoring(mp_bitcnt_t p, int from_bits, int to_bits){
+    if (to_bits > MAX_TF_BITS) to_bits = MAX_TF_BITS;
+    if (from_bits >= to_bits) return 0;
+
+    unsigned long long two_p = 2ULL * p;
+    unsigned long long k = ((1ULL << from_bits) - 1 + two_p - 1) / two_p; // first k with 2kp+1 >= 2^from_bits
+    unsigned long long k_max = ((1ULL << to_bits) - 2) / two_p; // last k with 2kp+1 < 2^to_bits
+    if (k == 0) k = 1;
+
+    for (; k <= k_max; k++){
+        unsigned long long q = two_p * k + 1;
+        if (p < 64 && q >= (1ULL << p) - 1) break; // q would be the Mersenne's number itself
+        unsigned int r8 = q & 7;
+        if (r8 != 1 && r8 != 7) continue;
+        if ((q % 3 == 0 && q != 3) || (q % 5 == 0 && q != 5) || (q % 7 == 0 && q != 7) ||
+            (q % 11 == 0 && q != 11) || (q % 13 == 0 && q != 13)) continue; // q is not prime, its prime factors were tested earlier
+
+        if (pow2_mod(p, q) == 1) return q; // q divides 2^p-1
+    }
+    return 0;
+}
+
+
+/**
+ * @brief Pollard's p-1 factoring of a Mersenne's number
+ * @details Stage 1 computes a = 3^(2p*E) mod 2^p-1, E = product of the prime powers up to B1.
+ * Stage 2 extends it to one extra prime between B1 and B2.
+ * A factor q is found when q-1 = 2kp and k is B1-smooth (apart from one prime up to B2).
+ * Time complexity: O((B1 + B2 / log B2) * m^1.6), m = digits of the Mersenne's number
+ * @param factor Preinitialized, set to the factor found
+ * @param p The exponent of the Mersenne's number
+ * @param mersenne The Mersenne's number 2^p-1
+ * @param B1 Bound of the first stage
+ * @param B2 Bound of the second stage (no second stage if B2 <= B1)
+ * @return int 1 if a proper factor is found, otherwise 0
+ */
+int p_minus_1(mpz_t factor, mp_bitcnt_t p, const mpz_t mersenne, unsigned long B1, unsigned long B2){
+    if (B2 > MAX_B2) B2 = MAX_B2;
+    if (B2 < B1) B2 = B1;
+
+    size_t count = 0;
+    unsigned long* primes = sieve_primes(B2, &count);
+    mpz_t a, tmp, x, acc, acc_gap;
+    mpz_inits(a, tmp, x, acc, acc_gap, NULL);
+    mpz_set_ui(a, 3);
+
+    // stage 1: the exponent is applied in word sized chunks
+    unsigned long long chunk = 2ULL * p;
+    size_t i = 0;
+    for (; i < count && primes[i] <= B1; i++){
+        unsigned long long power = primes[i];
+        while (power <= B1 / primes[i]) power *= primes[i]; // largest power <= B1
+        if (chunk > ~0ULL / power){
+            pow_mersenne(a, a, chunk, p, mersenne);
+            chunk = 1;
+        }
+        chunk *= power;
+    }
+    pow_mersenne(a, a, chunk, p, mersenne);
+
+    mpz_sub_ui(tmp, a, 1);
+    mpz_gcd(factor, tmp, mersenne);
+    int found = mpz_cmp_ui(factor, 1) > 0 && mpz_cmp(factor, mersenne) < 0;
+
+    // stage 2: x walks a^q for each prime q in (B1, B2], acc collects the product of (x-1)
+    if (!found && i < count){
+        mpz_t gaps[128]; // gaps[g/2] = a^g, prime gaps are even
+        for (int g = 0; g < 128; g++) mpz_init(gaps[g]);
+        mpz_mul(gaps[1], a, a);
+        mod_mersenne(gaps[1], tmp, p, mersenne);
+        for (int g = 2; g < 128; g++){
+            mpz_mul(gaps[g], gaps[g - 1], gaps[1]);
+            mod_mersenne(gaps[g], tmp, p, mersenne);
+        }
+
+        pow_mersenne(x, a, primes[i], p, mersenne);
+        mpz_set_ui(acc, 1);
+        for (; i < count; i++){
+            mpz_sub_ui(tmp, x, 1);
+            mpz_mul(acc, acc, tmp);
+            mod_mersenne(acc, tmp, p, mersenne);
+            if (i + 1 == count) break;
+
+            unsigned long gap = primes[i + 1] - primes[i];
+            if (gap / 2 < 128) mpz_mul(x, x, gaps[gap / 2]);
+            else {
+                pow_mersenne(acc_gap, a, gap, p, mersenne);
+                mpz_mul(x, x, acc_gap);
+            }
+            mod_mersenne(x, tmp, p, mersenne);
+        }
+        mpz_gcd(factor, acc, mersenne);
+        found = mpz_cmp_ui(factor, 1) > 0 && mpz_cmp(factor, mersenne) < 0;
+
+        for (int g = 0; g < 128; g++) mpz_clear(gaps[g]);
+    }
+
+    mpz_clears(a, tmp, x, acc, acc_gap, NULL);
+    free(primes);
+    return found;
+}
+
+
+/**
+ * @brief Lucas-Lehmer primality test of a Mersenne's number
+ * @details s = 4, s = s^2-2 mod 2^p-1 repeated p-2 times, 2^p-1 is prime <=> s = 0.
+ * Unlike Miller-Rabin the answer is certain.
+ * Time complexity: O(p * m^1.6), m = digits of the Mersenne's number
+ * @param p The exponent of the Mersenne's number (prime)
+ * @param mersenne The Mersenne's number 2^p-1
+ * @return int 1 if the Mersenne's number is prime, otherwise 0
+ */
+int lucas_lehmer(mp_bitcnt_t p, const mpz_t mersenne){
+    if (p == 2) return 1; // 3 is prime, the test works for odd p
+
+    mpz_t s, tmp;
+    mpz_inits(s, tmp, NULL);
+    mpz_set_ui(s, 4);
+    for (mp_bitcnt_t i = 0; i < p - 2; i++){
+        mpz_mul(s, s, s);
+        mod_mersenne(s, tmp, p, mersenne);
+        if (mpz_cmp_ui(s, 2) < 0) mpz_add(s, s, mersenne); // avoids negative numbers
+        mpz_sub_ui(s, s, 2);
+    }
+    int prime = mpz_sgn(s) == 0;
+    mpz_clears(s, tmp, NULL);
+    return prime;
+}
+
+
+
+// :::::::::::::::::::::::::::::::::::::::::::::::::: COST_MODEL :::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+#define CALIBRATION_POINTS 9 // squarings are measured from 2^10 to 2^18 bits
+#define TF_SURVIVORS 0.1918 // fraction of k tested: 1/2 (mod 8) * (2/3)(4/5)(6/7)(10/11)(12/13) (small primes)
+#define RHO_STEP 0.01
+#define RHO_MAX 40.0
+#define RHO_TABLE_SIZE 4002 // RHO_MAX / RHO_STEP + 2
+
+/**
+ * @struct cost_model
+ * @brief Timings measured on this machine
+ * @details Seconds of a squaring modulo 2^p-1 for some sizes of p
+ * and seconds of a trial factoring test for each bit of p.
+ * Time complexity: O(1)
+ */
+typedef struct{
+    double bits[CALIBRATION_POINTS];
+    double squaring_seconds[CALIBRATION_POINTS];
+    double tf_seconds_per_bit;
+} cost_model;
+
+
+/**
+ * @brief Calibrates the cost model with microbenchmarks
+ * @details Squares modulo 2^p-1 for p = 2^10, ..., 2^18 (each size for at least 10 milliseconds)
+ * and times 2^p mod q for a batch of 64 bits candidates.
+ * Time complexity: O(1), ~0.2 seconds
+ * @return cost_model The measured timings
+ */
+cost_model calibrate_cost_model(){
+    cost_model model;
+    mpz_t s, tmp, mersenne;
+    mpz_inits(s, tmp, mersenne, NULL);
+
+    for (int i = 0; i < CALIBRATION_POINTS; i++){
+        mp_bitcnt_t p = 1UL << (10 + i);
+        mpz_ui_pow_ui(mersenne, 2, p);
+        mpz_sub_ui(mersenne, mersenne, 1);
+        mpz_set_ui(s, 3);
+        mpz_pow_ui(s, s, p / 2); // ~p bits with no special structure
+
+        unsigned long squarings = 0;
+        clock_t start = clock();
+        clock_t elapsed = 0;
+        while (squarings < 3 || elapsed < CLOCKS_PER_SEC / 100){
+            for (int j = 0; j < 8; j++){
+                mpz_mul(s, s, s);
+                mod_mersenne(s, tmp, p, mersenne);
+            }
+            squarings += 8;
+            elapsed = clock() - start;
+        }
+        model.bits[i] = (double)p;
+        model.squaring_seconds[i] = (double)elapsed / CLOCKS_PER_SEC / squarings;
+    }
+
+    mp_bitcnt_t p = 1000003;
+    unsigned long long sink = 0;
+    const unsigned long tests = 200000;
+    clock_t start = clock();
+    for (unsigned long k = 1; k <= tests; k++) sink += pow2_mod(p, (1ULL << 62) + 2 * k * p + 1);
+    double seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+    model.tf_seconds_per_bit = (seconds + (sink == 0) * 1e-12) / tests / log2((double)p); // sink keeps the loop alive
+
+    mpz_clears(s, tmp, mersenne, NULL);
+    return model;
+}
+
+
+/**
+ * @brief Estimated seconds of a squaring modulo 2^p-1
+ * @details Piecewise linear interpolation of the calibration in log-log scale,
+ * outside the calibrated sizes the nearest segment is extended.
+ * Time complexity: O(1)
+ * @param model The calibrated cost model
+ * @param p The exponent of the Mersenne's number
+ * @return double Seconds of one squaring
+ */
+double squaring_seconds(const cost_model* model, mp_bitcnt_t p){
+    double x = log((double)p);
+    int i = 0;
+    while (i < CALIBRATION_POINTS - 2 && x > log((*model).bits[i + 1])) i++;
+
+    double x0 = log((*model).bits[i]), x1 = log((*model).bits[i + 1]);
+    double y0 = log((*model).squaring_seconds[i]), y1 = log((*model).squaring_seconds[i + 1]);
+    return exp(y0 + (y1 - y0) * (x - x0) / (x1 - x0));
+}
+
+
+/**
+ * @brief Estimated seconds of the Lucas-Lehmer test
+ * @details Time complexity: O(1)
+ * @param model The calibrated cost model
+ * @param p The exponent of the Mersenne's number
+ * @return double Seconds of p-2 squarings
+ */
+double lucas_lehmer_seconds(const cost_model* model, mp_bitcnt_t p){
+    return (double)(p - 2) * squaring_seconds(model, p);
+}
+
+
+/**
+ * @brief Estimated seconds of trial factoring one bit level
+ * @details Time complexity: O(1)
+ * @param model The calibrated cost model
+ * @param p The exponent of the Mersenne's number
+ * @param bits The level: candidates between 2^(bits-1) and 2^bits
+ * @return double Seconds of the level
+ */
+double trial_factoring_seconds(const cost_model* model, mp_bitcnt_t p, int bits){
+    double candidates = ldexp(1.0, bits - 1) / (2.0 * p);
+    return candidates * TF_SURVIVORS * log2((double)p) * (*model).tf_seconds_per_bit;
+}
+
+
+/**
+ * @brief Estimated seconds of p-1
+ * @details Stage 1 costs ~1.44*B1 squarings (bits of E) plus the multiplications,
+ * stage 2 costs 2 multiplications for each prime between B1 and B2.
+ * Time complexity: O(1)
+ * @param model The calibrated cost model
+ * @param p The exponent of the Mersenne's number
+ * @param B1 Bound of the first stage
+ * @param B2 Bound of the second stage
+ * @return double Seconds of p-1
+ */
+double p_minus_1_seconds(const cost_model* model, mp_bitcnt_t p, unsigned long B1, unsigned long B2){
+    double squaring = squaring_seconds(model, p);
+    double stage1 = 1.5 * (B1 / log(2.0) + log2(2.0 * p)) * squaring;
+    double primes = B2 > B1 ? B2 / log((double)B2) - B1 / log((double)B1) : 0;
+    return stage1 + 2.0 * primes * squaring;
+}
+
+
+/**
+ * @brief Dickman's function
+ * @details rho(u) is the probability that a random number n is n^(1/u)-smooth.
+ * The table is computed at the first call integrating rho'(u) = -rho(u-1)/u.
+ * Time complexity: O(1), O(RHO_MAX / RHO_STEP) for the first call
+ * @param u The ratio log(n) / log(bound)
+ * @return double rho(u)
+ */
+double dickman_rho(double u){
+    static double table[RHO_TABLE_SIZE];
+    static int ready = 0;
+    const int one = (int)(1.0 / RHO_STEP + 0.5);
+
+    if (!ready){
+        for (int i = 0; i <= one; i++) table[i] = 1.0;
+        for (int i = one + 1; i < RHO_TABLE_SIZE; i++){
+            double u0 = (i - 1) * RHO_STEP, u1 = i * RHO_STEP;
+            double slope = table[i - 1 - one] / u0 + table[i - one] / u1; // trapezoidal rule
+            table[i] = table[i - 1] - slope * RHO_STEP / 2;
+            if (table[i] < 0) table[i] = 0;
+        }
+        ready = 1;
+    }
+
+    if (u <= 1) return 1.0;
+    if (u >= RHO_MAX) return 0.0;
+    int i = (int)(u / RHO_STEP);
+    double t = u / RHO_STEP - i;
+    return table[i] * (1 - t) + table[i + 1] * t;
+}
+
+
+/**
+ * @brief Probability that a number is smooth enough for p-1
+ * @details The number must be B1-smooth apart from at most one prime between B1 and B2:
+ * rho(log n / log B1) + integral over log B1 < s < log B2 of rho((log n - s) / log B1) ds / s.
+ * Time complexity: O(1)
+ * @param bits Bits of the number
+ * @param B1 Bound of the first stage
+ * @param B2 Bound of the second stage
+ * @return double The probability
+ */
+double smooth_probability(double bits, unsigned long B1, unsigned long B2){
+    if (bits <= 0) return 1.0;
+
+    double log_n = bits * log(2.0), log_b1 = log((double)B1);
+    double probability = dickman_rho(log_n / log_b1);
+
+    if (B2 > B1){
+        const int steps = 32;
+        double from = log_b1, to = log((double)B2);
+        if (to > log_n) to = log_n;
+        double h = (to - from) / steps;
+        for (int i = 0; i < steps && h > 0; i++){
+            double s = from + (i + 0.5) * h; // midpoint rule
+            probability += dickman_rho((log_n - s) / log_b1) * h / s;
+        }
+    }
+    return probability > 1.0 ? 1.0 : probability;
+}
+
+
+/**
+ * @brief Probability that p-1 finds a factor of a Mersenne's number
+ * @details A factor of 2^p-1 with q bits exists with probability ~1/q,
+ * it is found when the cofactor (q-1)/(2p) is smooth.
+ * Factors below 2^tf_bits were excluded by trial factoring.
+ * Time complexity: O(p)
+ * @param p The exponent of the Mersenne's number
+ * @param tf_bits Trial factoring depth
+ * @param B1 Bound of the first stage
+ * @param B2 Bound of the second stage
+ * @return double The probability
+ */
+double p_minus_1_probability(mp_bitcnt_t p, int tf_bits, unsigned long B1, unsigned long B2){
+    if (B1 < 2) return 0.0;
+
+    double probability = 0;
+    double log2_2p = log2(2.0 * p);
+    for (int q_bits = tf_bits + 1; q_bits <= (int)(p / 2 + 1); q_bits++){
+        double level = smooth_probability(q_bits - log2_2p, B1, B2) / q_bits;
+        probability += level;
+        if (level < 1e-9) break;
+    }
+    return probability > 1.0 ? 1.0 : probability;
+}
+
+
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::: SCHEDULER :::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+/**
+ * @struct schedule
+ * @brief Effort chosen for a Mersenne's number and how it turned out
+ * @details Time complexity: O(1)
+ */
+typedef struct{
+    mp_bitcnt_t p;
+    int tf_bits; // trial factoring depth (candidates < 2^tf_bits)
+    unsigned long B1; // 0 if p-1 is skipped
+    unsigned long B2;
+    double predicted_seconds; // expected time to a result
+    double tf_probability, pm1_probability;
+    const char* stage; // stage that gave the result: "TF", "P-1" or "LL"
+    int prime;
+    double tf_seconds, pm1_seconds, ll_seconds;
+} schedule;
+
+
+/**
+ * @brief Chooses trial factoring depth and p-1 bounds for an exponent
+ * @details A bit level is trial factored while its cost is lower than the Lucas-Lehmer time it saves on average
+ * (probability 1/bits of a factor in the level).
+ * Then B1 and B2 are chosen on a grid minimizing cost(p-1) + (1 - probability(p-1)) * cost(LL),
+ * p-1 is skipped if no bound is convenient.
+ * Time complexity: O(p)
+ * @param model The calibrated cost model
+ * @param p The exponent of the Mersenne's number
+ * @return schedule The chosen effort with the expected time to a result
+ */
+schedule plan_exponent(const cost_model* model, mp_bitcnt_t p){
+    schedule plan = {p, 0, 0, 0, 0, 0, 0, "", 0, 0, 0, 0};
+    double ll = lucas_lehmer_seconds(model, p);
+
+    // trial factoring: the smallest possible factor is 2p+1
+    int bits = (int)log2(2.0 * p + 1) + 1;
+    int max_bits = p / 2 + 1 < MAX_TF_BITS ? (int)(p / 2 + 1) : MAX_TF_BITS;
+    double no_factor = 1.0, expected = 0;
+    while (bits < max_bits){
+        double cost = trial_factoring_seconds(model, p, bits + 1);
+        double probability = 1.0 / (bits + 1);
+        if (cost >= probability * ll) break;
+
+        expected += no_factor * cost;
+        no_factor *= 1 - probability;
+        bits++;
+    }
+    plan.tf_bits = bits < max_bits ? bits : max_bits;
+    plan.tf_probability = 1 - no_factor;
+
+    // p-1: B1 = 0 means skipped
+    double best = ll;
+    const unsigned long b2_ratios[] = {1, 20, 50};
+    for (unsigned long B1 = 1000; B1 <= 4096000; B1 *= 2){
+        if (p_minus_1_seconds(model, p, B1, B1) >= ll) break;
+
+        for (int r = 0; r < 3; r++){
+            unsigned long B2 = B1 * b2_ratios[r];
+            if (B2 > MAX_B2) break;
+
+            double probability = p_minus_1_probability(p, bits, B1, B2);
+            double cost = p_minus_1_seconds(model, p, B1, B2) + (1 - probability) * ll;
+            if (cost < best){
+                best = cost;
+                plan.B1 = B1;
+                plan.B2 = B2;
+                plan.pm1_probability = probability;
+            }
+        }
+    }
+    plan.predicted_seconds = expected + no_factor * best;
+    return plan;
+}
+
+
+/**
+ * @brief Runs the stages chosen for a Mersenne's number
+ * @details Trial factoring, then p-1, then Lucas-Lehmer, stopping at the first stage giving a result.
+ * The outcome and the seconds of each stage are stored in the schedule.
+ * Time complexity: O(p * m^1.6) in the worst case, m = digits of the Mersenne's number
+ * @param plan The chosen effort, completed with the outcome
+ * @param mersenne The Mersenne's number 2^p-1
+ * @param factor Preinitialized, set to the factor found (0 if none)
+ * @return int 1 if the Mersenne's number is prime, otherwise 0
+ */
+int run_schedule(schedule* plan, const mpz_t mersenne, mpz_t factor){
+    mp_bitcnt_t p = (*plan).p;
+    mpz_set_ui(factor, 0);
+
+    clock_t time = clock();
+    unsigned long long q = trial_factoring(p, (int)log2(2.0 * p + 1), (*plan).tf_bits);
+    (*plan).tf_seconds = (double)(clock() - time) / CLOCKS_PER_SEC;
+    if (q){
+        mpz_set_ui(factor, q);
+        (*plan).stage = "TF";
+        return (*plan).prime = 0;
+    }
+
+    if ((*plan).B1){
+        time = clock();
+        int found = p_minus_1(factor, p, mersenne, (*plan).B1, (*plan).B2);
+        (*plan).pm1_seconds = (double)(clock() - time) / CLOCKS_PER_SEC;
+        if (found){
+            (*plan).stage = "P-1";
+            return (*plan).prime = 0;
+        }
+        mpz_set_ui(factor, 0);
+    }
+
+    time = clock();
+    (*plan).prime = lucas_lehmer(p, mersenne);
+    (*plan).ll_seconds = (double)(clock() - time) / CLOCKS_PER_SEC;
+    (*plan).stage = "LL";
+    return (*plan).prime;
+}
+
+
+/**
+ * @brief Logs the choice made for an exponent and how it turned out
+ * @details Writes one CSV line: exponent, chosen effort, predicted seconds, result and measured seconds of each stage.
+ * Time complexity: O(m), m = digits of the factor
+ * @param log File where the line is written (NULL for no log)
+ * @param plan The executed schedule
+ * @param factor The factor found (0 if none)
+ * @return void Doesn't return a value
+ */
+void log_schedule(FILE* log, const schedule* plan, const mpz_t factor){
+    if (!log) return;
+
+    double total = (*plan).tf_seconds + (*plan).pm1_seconds + (*plan).ll_seconds;
+    gmp_fprintf(log, "%lu,%d,%lu,%lu,%.3f,%.3f,%.6f,%s,%s,%Zd,%.6f,%.6f,%.6f,%.6f\n",
+                (*plan).p, (*plan).tf_bits, (*plan).B1, (*plan).B2,
+                (*plan).tf_probability, (*plan).pm1_probability, (*plan).predicted_seconds,
+                (*plan).prime ? "prime" : "composite", (*plan).stage, factor,
+                (*plan).tf_seconds, (*plan).pm1_seconds, (*plan).ll_seconds, total);
+    fflush(log);
+}
+
+
+
+// :::::::::::::::::::::::::::::::::::::::::::::::: PERFECT_NUMBERS ::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+/**
+ * @brief Generates a linked list containing n perfect numbers
+ * @details Uses Mersenne primes to compute even perfect numbers and stores them in a linked list.
+ * Every prime exponent is scheduled with the cost model and the choice is logged.
+ * Prints the execution time.
+ * Time complexity: O(n * p * m^1.6),
+ * n = number of perfect numbers to generate,
+ * p = largest exponent tested,
+ * m = digits of the largest Mersenne's number
+ * @param n Number of perfect numbers to generate
+ * @param prime_index The starting prime number
+ * @param log File where the schedules are logged (NULL for no log)
+ * @return node* Pointer to the head of the linked list containing the perfect numbers
+ */
+node* find_perfect_numbers(unsigned short int n, mp_bitcnt_t prime_index, FILE* log){
+    clock_t time = clock();
+    cost_model model = calibrate_cost_model();
+    mpz_t mersenne, perfect_number, factor; // defines
+    size_t length = 0;
+    mpz_inits(mersenne, perfect_number, factor, NULL); // initializes variables until NULL
+    node* head = NULL;
+
+    while (n > 0){
+        prime_index++;
+        if (!is_prime_exponent(prime_index)) continue; // 2^p-1 is composite
+
+        mpz_ui_pow_ui(mersenne, 2, prime_index); // mersenne = 2^prime_index
+        mpz_sub_ui(mersenne, mersenne, 1); // mersenne--
+
+        schedule plan = plan_exponent(&model, prime_index);
+        int prime = run_schedule(&plan, mersenne, factor);
+        log_schedule(log, &plan, factor);
+        if (!prime) continue;
+
+        mpz_mul_2exp(perfect_number, mersenne, prime_index-1); // perfect_number = mersenne * 2^(prime_index-1)
+        length = mpz_sizeinbase(perfect_number, 10); // length = len(perfect_number)
+
+        node* new_node = create_node(prime_index, length, perfect_number); // possibile failure to memory allocation handled in create_node
+        head = insertion_head_node(head, new_node);
+
+        n--;
+    }
+
+    mpz_clears(mersenne, perfect_number, factor, NULL);
+    printf("Execution time: %.2fsec.\n", (double)(clock() - time) / CLOCKS_PER_SEC);
+    return head;
+}
+
+/**
+ * @brief Wrapper function to find the first n perfect numbers
+ * @details Time complexity: O(n * p * m^1.6),
+ * n = number of perfect numbers to generate,
+ * p = largest exponent tested,
+ * m = digits of the largest Mersenne's number
+ * @param n Number of perfect numbers to generate
+ * @param log File where the schedules are logged (NULL for no log)
+ * @return node* Pointer to the head of the linked list containing the perfect numbers
+ */
+node* perfect_numbers(unsigned short int n, FILE* log) {
+    mp_bitcnt_t prime_start = 1; // define and initialize
+    return find_perfect_numbers(n, prime_start, log);
+}
+/**
+ * @brief Wrapper function to find n perfect numbers from a given prime number
+ * @details Time complexity: O(n * p * m^1.6),
+ * n = number of perfect numbers to generate,
+ * p = largest exponent tested,
+ * m = digits of the largest Mersenne's number
+ * @param n Number of perfect numbers to generate
+ * @param prime_start Starting prime number
+ * @param log File where the schedules are logged (NULL for no log)
+ * @return node* Pointer to the head of the linked list containing the perfect numbers
+ */
+node* perfect_numbers_with_start_prime(unsigned short int n, mp_bitcnt_t prime_start, FILE* log) {
+    return find_perfect_numbers(n, prime_start, log);
+}
+
+
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::::::: TESTS :::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+/**
+ * @brief Entry point of the program
+ * @details Prompts the user to enter the number of perfect numbers to generate,
+ * computes them and prints the resulting list.
+ * The schedule of every exponent is appended to perfectNumbersV3_log.csv.
+ * Time complexity: O(n * p * m^1.6),
+ * n = number of perfect numbers to generate,
+ * p = largest exponent tested,
+ * m = digits of the largest Mersenne's number
+ * @warning Assumes valid user input
+ * @return 0 on successful execution
+ */
+int main(){
+    unsigned short int list_lenght = 0;
+    // mp_bitcnt_t prime_start = 23209; // define and initialize
+
+    printf("How many perfect numbers? ");
+    if (scanf("%hu", &list_lenght) != 1) return 1;
+
+    FILE* log = fopen("perfectNumbersV3_log.csv", "a");
+    if (log) fseek(log, 0, SEEK_END);
+    if (log && ftell(log) == 0) fprintf(log, "p,tf_bits,B1,B2,tf_probability,pm1_probability,predicted_s,result,stage,factor,tf_s,pm1_s,ll_s,total_s\n");
+
+    node* result = perfect_numbers(list_lenght, log);
+    print_list(result);
+    if (log) fclose(log);
+    return 0;
+
+    /* compiling: gcc perfectNumbersV3.c -o perfectNumbersV3 -lgmp -lm
+    executing: perfectNumbersV3 */
+}
+
+
+
+// ::::::::::::::::::::::::::::::::::::::::::::::: POSSIBLE UPGRADES :::::::::::::::::::::::::::::::::::::::::::::::::::::::
+/* stage 2 of p-1 uses the prime gaps one by one, a baby step giant step stage 2 would allow bigger B2
+trial factoring is limited to 63 bits, enough for the exponents reachable on a single machine */
@@ -0,0 +1,630 @@
+// ::::::::::::::::::::::::::::::::::::::::::::::::: LIBRARIES :::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+/**
+ * @file persistentList.c
+ * @author Lorenzo Mercuri
+ * @brief Methods for persistent lists: immutable nodes shared between versions
+ * @details A node is never changed after it is created, so a list is a version that can be kept as long as needed:
+ * a snapshot is one more reference to the head. A change creates a new version, copying the nodes before the
+ * changed one and sharing the nodes after it with the old version. Each node counts the references to it
+ * (from the node before it and from the holders of the lists) and is freed when the last one is released,
+ * with atomic counters, so versions are shared and released by any thread.
+ * A persistent_root is a shared variable with the current version: readers take snapshots without locks,
+ * writers replace the version with a compare and swap, without waiting for the readers
+ * (split reference counts: the root counts the readers of its head, moved to the node when it is replaced).
+ * (persistent data structures: https://en.wikipedia.org/wiki/Persistent_data_structure).
+ * linkedList.c is included for the comparison with copying a list of nodes
+ */
+#define LINKEDLIST_NO_MAIN
+#include "linkedList.c"
+#include <stdatomic.h>
+#include <stdint.h>
+
+
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::: PERSISTENT_LIST :::::::::::::::::::::::::::::::::::::::::::::::::::::::
+/* LIST OF FUNCTIONS:
+    creations:
+        1) persistent_create_node
+        2) persistent_prepend
+        3) persistent_create_list
+    references:
+        4) persistent_snapshot
+        5) persistent_release
+    6) persistent_print
+    7) persistent_length
+    8) persistent_rest
+    9) persistent_value_in
+    new versions (path copying, with persistent_copy_path):
+        10) persistent_insertion_at
+        11) persistent_remove_node_with_value
+        12) persistent_change_node_value_with_value
+        13) persistent_concatenate
+    14) persistent_to_linked_list
+    shared root:
+        15) persistent_root_init (with persistent_root_word)
+        16) persistent_root_snapshot
+        17) persistent_root_replace
+        18) persistent_root_clear */
+
+
+/**
+ * @struct pnode
+ * @brief Represent an immutable node of a persistent list
+ * @details It has a value, the length of the list starting at the node,
+ * the number of references to the node and the pointer to the next node (which holds a reference to it).
+ * Time complexity: O(1)
+ */
+typedef struct pnode{
+    int value1; // change type if needed (apply changes to all references)
+    unsigned int length;
+    atomic_uint references;
+    struct pnode* next;
+} pnode;
+
+#if UINTPTR_MAX <= 0xFFFFFFFFu
+#error "persistent_root needs 64 bits pointers: it counts the readers in the high bits of the head"
+#endif
+#define PERSISTENT_READERS_SHIFT 48 // user space addresses have 48 bits (x86-64, AArch64)
+#define PERSISTENT_READER ((uintptr_t)1 << PERSISTENT_READERS_SHIFT) // one reader in the word of a root
+#define PERSISTENT_HEAD_MASK (PERSISTENT_READER - 1)
+
+/**
+ * @struct persistent_root
+ * @brief Represent a shared variable with the current version of a persistent list
+ * @details One word with the head of the current version (one reference is held by the root) in the low bits
+ * and, in the high 16 bits, the number of readers of that head between reading it and taking their reference.
+ * Time complexity: O(1)
+ */
+typedef struct{
+    _Alignas(64) atomic_uintptr_t word;
+} persistent_root;
+
+
+/**
+ * @brief Creates a new node of a persistent list
+ * @details The node takes the reference to next of the caller (no reference is added).
+ * Time complexity: O(1)
+ * @warning If memory allocation fails prints an error and exit program
+ * @param v1 Value of the node
+ * @param next Pointer to the next node, NULL for the last node
+ * @return pnode* Pointer to the new node, with one reference for the caller
+ */
+pnode* persistent_create_node(int v1, pnode* next){
+    pnode* n = (pnode*)malloc(sizeof(pnode));
+    if (!n) {
+        printf("Memory allocation failed\n");
+        exit(EXIT_FAILURE); // critical error
+    }
+    (*n).value1 = v1;
+    (*n).length = next ? (*next).length + 1 : 1;
+    atomic_init(&(*n).references, 1u);
+    (*n).next = next;
+    return n;
+}
+
+
+/**
+ * @brief Takes a snapshot of a persistent list
+ * @details One more reference to the head: the version stays valid until the snapshot is released.
+ * Time complexity: O(1)
+ * @param head Pointer to the head of the list
+ * @return pnode* The head, with one more reference for the caller
+ */
+pnode* persistent_snapshot(pnode* head){
+    if (head) atomic_fetch_add_explicit(&(*head).references, 1u, memory_order_relaxed);
+    return head;
+}
+
+
+/**
+ * @brief Adds a value at the head of a persistent list
+ * @details The new node shares the whole list, which is not changed.
+ * Time complexity: O(1)
+ * @warning If memory allocation fails prints an error and exit program
+ * @param head Pointer to the head of the list
+ * @param value The value to add
+ * @return pnode* Pointer to the head of the new version, with one reference for the caller
+ */
+pnode* persistent_prepend(pnode* head, int value){
+    return persistent_create_node(value, persistent_snapshot(head));
+}
+
+
+/**
+ * @brief Creates a persistent list with the values of an array
+ * @details The nodes are created from the last value.
+ * Time complexity: O(n), n = length
+ * @warning If memory allocation fails prints an error and exit program
+ * @param values Array of values
+ * @param length Number of elements in the values array
+ * @return pnode* Pointer to the head of the list, with one reference for the caller (NULL if length is 0)
+ */
+pnode* persistent_create_list(int values[], unsigned int length){
+    pnode* head = NULL;
+    for (unsigned int i = length; i-- > 0; ) head = persistent_create_node(values[i], head);
+    return head;
+}
+
+
+/**
+ * @brief Releases a reference to a persistent list
+ * @details If it was the last reference the node is freed and its reference to the next node is released,
+ * until a node still referenced by another version (or by a snapshot).
+ * Time complexity: O(k), k = number of freed nodes
+ * @param head Pointer to the head of the list
+ * @return void Doesn't return a value
+ */
+void persistent_release(pnode* head){
+    while (head && atomic_fetch_sub_explicit(&(*head).references, 1u, memory_order_acq_rel) == 1){
+        pnode* next = (*head).next;
+        free(head); // deallocate memory
+        head = next;
+    }
+}
+
+
+/**
+ * @brief Prints the values of each node of a persistent list
+ * @details Time complexity: O(n), n = number of nodes in the list
+ * @param head Pointer to the head of the list
+ * @return void Doesn't return a value
+ */
+void persistent_print(pnode* head){
+    if (!head) return;
+
+    printf("[");
+    for (pnode* temp = head; temp; temp = (*temp).next) printf((*temp).next ? "%d, " : "%d]", (*temp).value1);
+}
+
+
+/**
+ * @brief Length of a persistent list
+ * @details Read from the head.
+ * Time complexity: O(1)
+ * @param head Pointer to the head of the list
+ * @return unsigned int The number of nodes in the list
+ */
+unsigned int persistent_length(pnode* head){
+    return head ? (*head).length : 0;
+}
+
+
+/**
+ * @brief The list without its first node
+ * @details Shared with the list, which is not changed.
+ * Time complexity: O(1)
+ * @param head Pointer to the head of the list
+ * @return pnode* Pointer to the second node, with one reference for the caller (NULL if there isn't one)
+ */
+pnode* persistent_rest(pnode* head){
+    return head ? persistent_snapshot((*head).next) : NULL;
+}
+
+
+/**
+ * @brief Searches for a value in a persistent list
+ * @details Time complexity: O(n), n = number of nodes seen in the list
+ * @param head Pointer to the head of the list
+ * @param value Value to be searched for in the list
+ * @return pnode* Pointer to the first node with the searched value (no reference is added).
+ * If the value is not found returns NULL
+ */
+pnode* persistent_value_in(pnode* head, int value){
+    pnode* temp = head;
+    while (temp && (*temp).value1 != value) temp = (*temp).next;
+    return temp;
+}
+
+
+/**
+ * @brief Copies the nodes of a persistent list before a node, followed by another list
+ * @details Helper of the functions creating new versions. Each copy has its length changed by length_change.
+ * Time complexity: O(k), k = number of copied nodes
+ * @warning If memory allocation fails prints an error and exit program
+ * @param head Pointer to the head of the list
+ * @param stop Pointer to the first node not copied (NULL to copy the whole list)
+ * @param rest Pointer to the list after the copies, whose reference is taken by the last copy
+ * @param length_change Difference between the length of the new version and of the list
+ * @return pnode* Pointer to the first copy (rest if there is nothing to copy), with one reference for the caller
+ */
+pnode* persistent_copy_path(pnode* head, pnode* stop, pnode* rest, int length_change){
+    pnode* first = rest;
+    pnode* last = NULL;
+    for (pnode* temp = head; temp != stop; temp = (*temp).next){
+        pnode* n = persistent_create_node((*temp).value1, NULL);
+        (*n).length = (unsigned int)((int)(*temp).length + length_change);
+        if (last) (*last).next = n;
+        else first = n;
+        last = n;
+    }
+    if (last) (*last).next = rest;
+    return first;
+}
+
+
+/**
+ * @brief Inserts a value at a position of a persistent list
+ * @details The nodes before the position are copied, the nodes after it are shared.
+ * Time complexity: O(k), k = index
+ * @warning If memory allocation fails prints an error and exit program
+ * @param head Pointer to the head of the list
+ * @param index Position of the new value (0 for the head, the length of the list or more for the end)
+ * @param value The value to insert
+ * @return pnode* Pointer to the head of the new version, with one reference for the caller
+ */
+pnode* persistent_insertion_at(pnode* head, unsigned int index, int value){
+    pnode* stop = head;
+    for (unsigned int i = 0; i < index && stop; i++) stop = (*stop).next;
+
+    pnode* n = persistent_create_node(value, persistent_snapshot(stop));
+    return persistent_copy_path(head, stop, n, 1);
+}
+
+
+/**
+ * @brief Removes the first node with a value from a persistent list
+ * @details The nodes before it are copied, the nodes after it are shared.
+ * Time complexity: O(n), n = number of nodes seen in the list
+ * @warning If memory allocation fails prints an error and exit program
+ * @param head Pointer to the head of the list
+ * @param value The value of the node to be removed
+ * @return pnode* Pointer to the head of the new version, with one reference for the caller.
+ * If the value is not found it is a snapshot of the list
+ */
+pnode* persistent_remove_node_with_value(pnode* head, int value){
+    pnode* n = persistent_value_in(head, value);
+    if (!n) return persistent_snapshot(head);
+
+    return persistent_copy_path(head, n, persistent_snapshot((*n).next), -1);
+}
+
+
+/**
+ * @brief Changes the value of the first node with a value in a persistent list
+ * @details The nodes before it are copied, the nodes after it are shared.
+ * Time complexity: O(n), n = number of nodes seen in the list
+ * @warning If memory allocation fails prints an error and exit program
+ * @param head Pointer to the head of the list
+ * @param value The value of the node to be changed
+ * @param new_value The new value to be assigned to the node
+ * @return pnode* Pointer to the head of the new version, with one reference for the caller.
+ * If the value is not found it is a snapshot of the list
+ */
+pnode* persistent_change_node_value_with_value(pnode* head, int value, int new_value){
+    pnode* n = persistent_value_in(head, value);
+    if (!n) return persistent_snapshot(head);
+
+    pnode* changed = persistent_create_node(new_value, persistent_snapshot((*n).next));
+    return persistent_copy_path(head, n, changed, 0);
+}
+
+
+/**
+ * @brief Concatenates two persistent lists
+ * @details The nodes of the first list are copied, the second list is shared (not copied):
+ * O(1) when the first list is empty or short, whatever the length of the second one.
+ * Time complexity: O(n), n = number of nodes in the first list
+ * @warning If memory allocation fails prints an error and exit program
+ * @param head1 Pointer to the head of the first list
+ * @param head2 Pointer to the head of the second list
+ * @return pnode* Pointer to the head of the new version, with one reference for the caller
+ */
+pnode* persistent_concatenate(pnode* head1, pnode* head2){
+    return persistent_copy_path(head1, NULL, persistent_snapshot(head2), (int)persistent_length(head2));
+}
+
+
+/**
+ * @brief Creates a linked list with the values of a persistent list
+ * @details With an arena the nodes are consecutive nodes of one slab, otherwise one malloc for each node.
+ * Time complexity: O(n), n = number of nodes in the list
+ * @warning If memory allocation fails prints an error and exit program
+ * @param head Pointer to the head of the list
+ * @param a Pointer to the arena for the nodes, NULL to allocate them with malloc
+ * @return linked_list The new linked list
+ */
+linked_list persistent_to_linked_list(pnode* head, arena* a){
+    linked_list l = {NULL, NULL, 0};
+    if (!head) return l;
+
+    node* nodes = a ? arena_reserve_nodes(a, (*head).length) : NULL;
+    for (pnode* temp = head; temp; temp = (*temp).next){
+        node* n = a ? nodes + l.length : create_node((*temp).value1);
+        (*n).value1 = (*temp).value1;
+        (*n).next = NULL;
+        if (l.tail) (*l.tail).next = n;
+        else l.head = n;
+        l.tail = n;
+        l.length++;
+    }
+    return l;
+}
+
+
+/**
+ * @brief Word of a shared root with a head and no readers
+ * @details Time complexity: O(1)
+ * @warning If the address of the node doesn't fit in the low PERSISTENT_READERS_SHIFT bits
+ * prints an error and exit program
+ * @param head Pointer to the head of a version
+ * @return uintptr_t The word
+ */
+uintptr_t persistent_root_word(pnode* head){
+    if ((uintptr_t)head & ~PERSISTENT_HEAD_MASK){
+        printf("Address of the node out of the low %d bits\n", PERSISTENT_READERS_SHIFT);
+        exit(EXIT_FAILURE); // critical error
+    }
+    return (uintptr_t)head;
+}
+
+
+/**
+ * @brief Initializes a shared root with a version of a persistent list
+ * @details The root takes the reference of the caller.
+ * Time complexity: O(1)
+ * @param r Pointer to the root
+ * @param head Pointer to the head of the first version
+ * @return void Doesn't return a value
+ */
+void persistent_root_init(persistent_root* r, pnode* head){
+    if (!r) return;
+
+    atomic_init(&(*r).word, persistent_root_word(head));
+}
+
+
+/**
+ * @brief Takes a snapshot of the current version of a shared root
+ * @details Without locks: one atomic add reads the head and counts the reader in the root,
+ * so the head can't be freed before the reader adds its reference. Then the reader takes its count back
+ * from the root if it still has that head, otherwise from the node: the writer that replaced it
+ * moved the count of the root to the node.
+ * Time complexity: O(1), plus the retries when other readers change the count at the same time
+ * @param r Pointer to the root
+ * @return pnode* The head of the current version, with one reference for the caller
+ */
+pnode* persistent_root_snapshot(persistent_root* r){
+    if (!r) return NULL;
+
+    uintptr_t word = atomic_fetch_add(&(*r).word, PERSISTENT_READER);
+    pnode* head = persistent_snapshot((pnode*)(word & PERSISTENT_HEAD_MASK));
+
+    uintptr_t current = atomic_load(&(*r).word);
+    while ((current & PERSISTENT_HEAD_MASK) == (word & PERSISTENT_HEAD_MASK) && current >= PERSISTENT_READER)
+        if (atomic_compare_exchange_weak(&(*r).word, &current, current - PERSISTENT_READER)) return head;
+    if (head) atomic_fetch_sub(&(*head).references, 1u); // never the last one: the caller's reference is left
+    return head;
+}
+
+
+/**
+ * @brief Replaces the current version of a shared root
+ * @details Compare and swap from expected to head: fails if another writer replaced expected first
+ * (the caller takes a new snapshot, builds the version again and retries).
+ * On success the root takes the reference of the caller to head. The readers of expected counted in the root
+ * are added to the references of expected, then the reference of the root is released:
+ * the writer doesn't wait for the readers, each one releases its count later.
+ * Time complexity: O(1), plus the nodes freed with the old version
+ * @warning If the address of head doesn't fit in the word prints an error and exit program
+ * @param r Pointer to the root
+ * @param expected Pointer to the head of the version the new one was built from
+ * @param head Pointer to the head of the new version
+ * @return int 1 if the version is replaced, 0 if the current version is not expected (head is still the caller's)
+ */
+int persistent_root_replace(persistent_root* r, pnode* expected, pnode* head){
+    if (!r) return 0;
+
+    uintptr_t word = persistent_root_word(head);
+    uintptr_t current = atomic_load(&(*r).word);
+    do {
+        if ((current & PERSISTENT_HEAD_MASK) != (uintptr_t)expected) return 0;
+    } while (!atomic_compare_exchange_weak(&(*r).word, &current, word));
+
+    if (expected){
+        atomic_fetch_add(&(*expected).references, (unsigned int)(current >> PERSISTENT_READERS_SHIFT));
+        persistent_release(expected);
+    }
+    return 1;
+}
+
+
+/**
+ * @brief Releases the current version of a shared root
+ * @details No thread may use the root any more.
+ * Time complexity: O(k), k = number of freed nodes
+ * @param r Pointer to the root
+ * @return void Doesn't return a value
+ */
+void persistent_root_clear(persistent_root* r){
+    if (!r) return;
+
+    persistent_release((pnode*)(atomic_exchange(&(*r).word, (uintptr_t)0) & PERSISTENT_HEAD_MASK));
+}
+
+
+
+
+// :::::::::::::::::::::::::::::::::::::::::::::::::: BENCHMARKS :::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+#define PERSISTENT_MAX_THREADS 64
+
+/**
+ * @struct persistent_job
+ * @brief Represent the work of a thread of the stress test
+ * @details Writers add the next version number at the head and remove the oldest value,
+ * readers check that each snapshot is window consecutive numbers.
+ * Time complexity: O(1)
+ */
+typedef struct{
+    persistent_root* root;
+    int writer;
+    unsigned int operations;
+    unsigned int window; // length of every version
+    unsigned int failures; // snapshots that were not a version (readers)
+    unsigned int retries; // failed replaces (writers)
+} persistent_job;
+
+/**
+ * @brief Thread function of the stress test
+ * @details Time complexity: O(operations * window)
+ * @param arg Pointer to the persistent_job
+ * @return void* NULL
+ */
+void* persistent_worker(void* arg){
+    persistent_job* job = (persistent_job*)arg;
+
+    for (unsigned int i = 0; i < (*job).operations; i++){
+        pnode* current = persistent_root_snapshot((*job).root);
+        if ((*job).writer){
+            pnode* added = persistent_prepend(current, (*current).value1 + 1);
+            pnode* next = persistent_remove_node_with_value(added, (*current).value1 + 1 - (int)(*job).window);
+            persistent_release(added);
+            if (!persistent_root_replace((*job).root, current, next)){
+                persistent_release(next);
+                (*job).retries++;
+                i--; // the version is built again from the new current one
+            }
+        } else {
+            int ok = current && (*current).length == (*job).window;
+            unsigned int length = 0;
+            for (pnode* temp = current; ok && temp; temp = (*temp).next, length++)
+                ok = (*temp).length == (*job).window - length && (*temp).value1 == (*current).value1 - (int)length;
+            (*job).failures += !ok || length != (*job).window;
+        }
+        persistent_release(current);
+    }
+    return NULL;
+}
+
+
+/**
+ * @brief Stress test of the shared root
+ * @details Writers and readers share a root with versions of window consecutive numbers (the newest at the head).
+ * Each writer creates the next version from a snapshot (copying the whole path to the removed tail),
+ * each reader walks snapshots, that must stay consistent while the root is replaced and the old versions freed.
+ * Time complexity: O(threads * operations * window)
+ * @param writers Number of writer threads
+ * @param readers Number of reader threads
+ * @param operations Number of versions created by each writer and snapshots taken by each reader
+ * @return int 1 if the test passes, 0 otherwise
+ */
+int persistent_stress_test(unsigned int writers, unsigned int readers, unsigned int operations){
+    if (writers > PERSISTENT_MAX_THREADS) writers = PERSISTENT_MAX_THREADS;
+    if (readers > PERSISTENT_MAX_THREADS - writers) readers = PERSISTENT_MAX_THREADS - writers;
+    const unsigned int window = 64;
+    int values[64];
+    for (unsigned int i = 0; i < window; i++) values[i] = (int)(window - 1 - i);
+    persistent_root r;
+    persistent_root_init(&r, persistent_create_list(values, window));
+
+    persistent_job jobs[PERSISTENT_MAX_THREADS];
+    pthread_t ids[PERSISTENT_MAX_THREADS];
+    int started[PERSISTENT_MAX_THREADS];
+    unsigned int threads = writers + readers;
+    double start = wall_seconds();
+    for (unsigned int i = 0; i < threads; i++){
+        persistent_job job = {&r, i < writers, operations, window, 0, 0};
+        jobs[i] = job;
+        started[i] = pthread_create(&ids[i], NULL, persistent_worker, &jobs[i]) == 0;
+        if (!started[i]) persistent_worker(&jobs[i]);
+    }
+    for (unsigned int i = 0; i < threads; i++) if (started[i]) pthread_join(ids[i], NULL);
+    double elapsed = wall_seconds() - start;
+
+    unsigned int failures = 0, retries = 0;
+    for (unsigned int i = 0; i < threads; i++){
+        failures += jobs[i].failures;
+        retries += jobs[i].retries;
+    }
+    pnode* last = persistent_root_snapshot(&r);
+    int passed = failures == 0 && (*last).value1 == (int)(window - 1 + writers * operations)
+                 && atomic_load(&(*last).references) == 2;
+    printf("stress test %s: %u writers, %u readers, %u operations each, %.3f s, %u failed replaces\n",
+           passed ? "passed" : "FAILED", writers, readers, operations, elapsed, retries);
+    persistent_release(last);
+    persistent_root_clear(&r);
+    return passed;
+}
+
+
+/**
+ * @brief Compares snapshots and changes of a persistent list with copying a linked list
+ * @details On n values prints the time of: a copy of a linked list (list_values and create_list)
+ * and a snapshot of a persistent list; a change of the first, middle and last value
+ * (path copying, the rest is shared) and the nodes created, and a prepend.
+ * Time complexity: O(n)
+ * @param n Number of nodes of the lists
+ * @return int 1 if the results are the same, 0 otherwise
+ */
+int benchmark_persistent(unsigned int n){
+    if (n == 0) return 1;
+    int* values = benchmark_values(n);
+    for (unsigned int i = 0; i < n; i++) values[i] = (int)i;
+    node* head = create_list(values, n);
+    pnode* p = persistent_create_list(values, n);
+
+    double start = wall_seconds();
+    int* copied_values = list_values(head);
+    node* copy = create_list(copied_values, n);
+    double copy_time = wall_seconds() - start;
+    start = wall_seconds();
+    pnode* snapshot = persistent_snapshot(p);
+    double snapshot_time = wall_seconds() - start;
+    printf("%u nodes: copy of a linked list %.3f ms, snapshot of a persistent list %.6f ms\n",
+           n, copy_time * 1e3, snapshot_time * 1e3);
+
+    int ok = 1;
+    unsigned int positions[3] = {0, n / 2, n - 1};
+    const char* names[3] = {"first", "middle", "last"};
+    for (int k = 0; k < 3; k++){
+        start = wall_seconds();
+        pnode* changed = persistent_change_node_value_with_value(snapshot, (int)positions[k], -1);
+        double change = wall_seconds() - start;
+        unsigned int created = 0;
+        pnode* temp = changed;
+        for (pnode* old = snapshot; old && old != temp; old = (*old).next, temp = (*temp).next) created++;
+        ok = ok && created == positions[k] + 1 && persistent_value_in(changed, -1) && !persistent_value_in(snapshot, -1)
+             && persistent_length(changed) == n;
+        printf("change of the %s value: %.3f ms, %u nodes copied, %u shared\n",
+               names[k], change * 1e3, created, n - created);
+        persistent_release(changed);
+    }
+    start = wall_seconds();
+    pnode* longer = persistent_prepend(snapshot, -1);
+    double prepend = wall_seconds() - start;
+    ok = ok && persistent_length(longer) == n + 1 && (*longer).next == snapshot;
+    printf("prepend: %.6f ms%s\n", prepend * 1e3, ok ? "" : " (DIFFERENT RESULTS)");
+
+    persistent_release(longer);
+    persistent_release(snapshot);
+    persistent_release(p);
+    clear_list(copy);
+    clear_list(head);
+    free(copied_values);
+    free(values);
+    return ok;
+}
+
+
+
+
+// :::::::::::::::::::::::::::::::::::::::::::::::::::::: TESTS ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+/**
+ * @brief Entry point of the program, used for testing
+ * @details Runs the stress test, then the benchmark (the optional arguments are the number of readers, default 3,
+ * of operations for each thread, default 20000, and of nodes of the benchmark, default 1000000).
+ * @param argc Number of arguments
+ * @param argv Arguments
+ * @return int 0 if the stress test and the benchmark pass, 1 otherwise
+ */
+int main(int argc, char* argv[]){
+    unsigned int readers = argc > 1 ? (unsigned int)strtoul(argv[1], NULL, 10) : 3;
+    unsigned int operations = argc > 2 ? (unsigned int)strtoul(argv[2], NULL, 10) : 20000;
+    unsigned int n = argc > 3 ? (unsigned int)strtoul(argv[3], NULL, 10) : 1000000;
+
+    int passed = persistent_stress_test(2, readers, operations);
+    passed = benchmark_persistent(n) && passed;
+    return passed ? 0 : 1;
+
+    /* compiling: gcc persistentList.c -o persistentList -lpthread
+    executing: persistentList [readers [operations [nodes]]] */
+}
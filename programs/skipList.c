@@ -0,0 +1,721 @@
+// ::::::::::::::::::::::::::::::::::::::::::::::::: LIBRARIES :::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+/**
+ * @file skipList.c
+ * @author Lorenzo Mercuri
+ * @brief Methods for skip list manipulation
+ * @details A sorted linked list where each node also has a random number of pointers that skip ahead:
+ * the level i links about one node every SKIP_FACTOR^i, so searches, insertions and removals
+ * go down from the highest level in O(log n) expected time instead of walking the whole list.
+ * (skip list: https://en.wikipedia.org/wiki/Skip_list
+ * W. Pugh, Skip lists: a probabilistic alternative to balanced trees: https://doi.org/10.1145/78973.78977).
+ * linkedList.c is included for the comparison with the sorted list of nodes
+ */
+#define LINKEDLIST_NO_MAIN
+#include "linkedList.c"
+
+
+
+// :::::::::::::::::::::::::::::::::::::::::::::::::: SKIP_LIST ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+/* LIST OF FUNCTIONS:
+    1) skip_create_node
+    levels:
+        2) skip_random_level
+        3) skip_find_before
+    in_list:
+        4) skip_lower_bound
+        5) skip_value_in_list
+    6) skip_insertion
+    creations:
+        7) skip_create_list
+        8) skip_from_list
+    9) skip_print_list
+    10) skip_clear_list
+    11) skip_split_list_at_node
+    12) skip_split_list_at_value
+    removes:
+        13) skip_remove_node
+        14) skip_remove_node_with_value
+    15) skip_is_empty_list
+    ranges:
+        16) skip_range_first
+        17) skip_range_values
+    18) skip_list_length
+    19) skip_max_list
+    20) skip_min_list
+    21) skip_count_frequents_in_list */
+
+
+#define SKIP_MAX_LEVEL 16 // enough for SKIP_FACTOR^16 = 4^16 = 2^32 nodes
+#define SKIP_FACTOR 4 // a node of level i has level i+1 with probability 1/SKIP_FACTOR
+
+/**
+ * @struct skip_node
+ * @brief Represent a node of a skip list
+ * @details It has a value and level pointers: next[0] is the next node, next[i] the next node of level greater than i.
+ * Time complexity: O(1)
+ */
+typedef struct skip_node{
+    int value1; // change type if needed (apply changes to all references)
+    int level;
+    struct skip_node* next[]; // level pointers
+} skip_node;
+
+/**
+ * @struct skip_list
+ * @brief Represent a skip list
+ * @details It has a head node without value with SKIP_MAX_LEVEL pointers (allocated at the first insertion),
+ * the highest level in use, the number of nodes and the state of the random levels.
+ * Time complexity: O(1)
+ */
+typedef struct{
+    skip_node* head;
+    int level;
+    unsigned int length;
+    unsigned int seed; // not 0
+} skip_list;
+
+
+/**
+ * @brief Create a new skip node
+ * @details Dynamically allocates memory for the node and its level pointers, set to NULL.
+ * Time complexity: O(level)
+ * @warning If memory allocation fails prints an error and exit program
+ * @param v1 The value of the node
+ * @param level The number of level pointers
+ * @return skip_node* Pointer to the new node
+ */
+skip_node* skip_create_node(int v1, int level){
+    skip_node* new_node = (skip_node*)malloc(sizeof(skip_node) + (size_t)level * sizeof(skip_node*));
+    if (!new_node) {
+        printf("Memory allocation failed\n");
+        exit(EXIT_FAILURE); // critical error
+    }
+
+    (*new_node).value1 = v1;
+    (*new_node).level = level;
+    for (int i = 0; i < level; i++) (*new_node).next[i] = NULL;
+    return new_node;
+}
+
+
+/**
+ * @brief Draws the level of a new node
+ * @details Level 1 with probability 1 - 1/SKIP_FACTOR, level 2 with (1 - 1/SKIP_FACTOR) / SKIP_FACTOR and so on.
+ * The random bits come from a xorshift generator (https://en.wikipedia.org/wiki/Xorshift) in the list.
+ * Time complexity: O(1)
+ * @param l Pointer to the skip list
+ * @return int The level, from 1 to SKIP_MAX_LEVEL
+ */
+int skip_random_level(skip_list* l){
+    unsigned int x = (*l).seed;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    (*l).seed = x;
+
+    int level = 1;
+    while (level < SKIP_MAX_LEVEL && x % SKIP_FACTOR == 0){
+        level++;
+        x /= SKIP_FACTOR;
+    }
+    return level;
+}
+
+
+/**
+ * @brief Finds the nodes before a node at every level
+ * @details Goes down from the highest level to the last nodes with a smaller value,
+ * then walks the nodes with the same value until n.
+ * Time complexity: O(log n + k) expected, n = number of nodes, k = number of nodes with the value of n before it
+ * @param l Pointer to the skip list
+ * @param n Pointer to the node
+ * @param before Array of SKIP_MAX_LEVEL pointers where the last node before n at each level is written
+ * (the head if there isn't one)
+ * @return int 1 if n is in the list, 0 otherwise
+ */
+int skip_find_before(skip_list* l, skip_node* n, skip_node* before[]){
+    if (!l || !n || !(*l).head) return 0;
+
+    skip_node* temp = (*l).head;
+    for (int i = SKIP_MAX_LEVEL - 1; i >= (*l).level; i--) before[i] = temp; // levels not in use
+    for (int i = (*l).level - 1; i >= 0; i--){
+        while ((*temp).next[i] && (*(*temp).next[i]).value1 < (*n).value1) temp = (*temp).next[i];
+        before[i] = temp;
+    }
+
+    for (temp = (*temp).next[0]; temp && temp != n && (*temp).value1 == (*n).value1; temp = (*temp).next[0])
+        for (int i = 0; i < (*temp).level; i++) before[i] = temp;
+    return temp == n;
+}
+
+
+/**
+ * @brief Finds the first node with a value greater than or equal to the argument
+ * @details Time complexity: O(log n) expected, n = number of nodes in the list
+ * @param l Pointer to the skip list
+ * @param value The value to search
+ * @return skip_node* Pointer to the node, NULL if every value is smaller
+ */
+skip_node* skip_lower_bound(skip_list* l, int value){
+    if (!l || !(*l).head) return NULL;
+
+    skip_node* temp = (*l).head;
+    for (int i = (*l).level - 1; i >= 0; i--)
+        while ((*temp).next[i] && (*(*temp).next[i]).value1 < value) temp = (*temp).next[i];
+    return (*temp).next[0];
+}
+
+/**
+ * @brief Finds the first node of the skip list with the value equals to the argument
+ * @details Time complexity: O(log n) expected, n = number of nodes in the list
+ * @param l Pointer to the skip list
+ * @param value The value to search
+ * @return skip_node* Pointer to the node.
+ * If the value is not found returns NULL
+ */
+skip_node* skip_value_in_list(skip_list* l, int value){
+    skip_node* n = skip_lower_bound(l, value);
+    return n && (*n).value1 == value ? n : NULL;
+}
+
+
+/**
+ * @brief Inserts a value in a skip list
+ * @details The new node goes after the nodes with the same value, so the insertion order of equal values is kept.
+ * Time complexity: O(log n) expected, n = number of nodes in the list
+ * @warning If memory allocation fails prints an error and exit program
+ * @param l Pointer to the skip list
+ * @param value The value to insert
+ * @return skip_node* Pointer to the new node
+ */
+skip_node* skip_insertion(skip_list* l, int value){
+    if (!l) return NULL;
+    if (!(*l).head) (*l).head = skip_create_node(0, SKIP_MAX_LEVEL);
+
+    skip_node* before[SKIP_MAX_LEVEL];
+    skip_node* temp = (*l).head;
+    for (int i = SKIP_MAX_LEVEL - 1; i >= (*l).level; i--) before[i] = temp; // levels not in use
+    for (int i = (*l).level - 1; i >= 0; i--){
+        while ((*temp).next[i] && (*(*temp).next[i]).value1 <= value) temp = (*temp).next[i];
+        before[i] = temp;
+    }
+
+    skip_node* n = skip_create_node(value, skip_random_level(l));
+    for (int i = 0; i < (*n).level; i++){
+        (*n).next[i] = (*before[i]).next[i];
+        (*before[i]).next[i] = n;
+    }
+    if ((*n).level > (*l).level) (*l).level = (*n).level;
+    (*l).length++;
+    return n;
+}
+
+
+/**
+ * @brief Create a new skip list
+ * @details Inserts the values one by one, in any order.
+ * Time complexity: O(n log n) expected, n = number of values
+ * @warning If memory allocation fails prints an error and exit program
+ * @param values Array of values to initialize the list
+ * @param length Number of elements in the values array
+ * @return skip_list The new list.
+ * If the argument is NULL or the length is zero returns an empty list
+ */
+skip_list skip_create_list(int values[], unsigned int length){
+    skip_list l = {NULL, 0, 0, 2463534242u};
+    if (values) for (unsigned int i = 0; i < length; i++) skip_insertion(&l, values[i]);
+    return l;
+}
+
+/**
+ * @brief Create a new skip list from a linked list of nodes
+ * @details Time complexity: O(n log n) expected, n = number of nodes in the list
+ * @warning If memory allocation fails prints an error and exit program
+ * @param head Pointer to the head of the linked list
+ * @return skip_list The new list with the same values, sorted
+ */
+skip_list skip_from_list(node* head){
+    skip_list l = skip_create_list(NULL, 0);
+    for (node* temp = head; temp; temp = (*temp).next) skip_insertion(&l, (*temp).value1);
+    return l;
+}
+
+
+/**
+ * @brief Prints the values of the skip list
+ * @details Time complexity: O(n), n = number of nodes in the list
+ * @param l Pointer to the skip list
+ * @return void Doesn't return a value
+ */
+void skip_print_list(skip_list* l){
+    if (!l || !(*l).head) return;
+
+    printf("[");
+    for (skip_node* temp = (*(*l).head).next[0]; temp; temp = (*temp).next[0])
+        printf((*temp).next[0] ? "%d, " : "%d", (*temp).value1);
+    printf("]");
+}
+
+
+/**
+ * @brief Frees the memory allocated for a skip list
+ * @details The nodes and the head are freed, the list becomes empty.
+ * Time complexity: O(n), n = number of nodes in the list
+ * @param l Pointer to the skip list
+ * @return void Doesn't return a value
+ */
+void skip_clear_list(skip_list* l){
+    if (!l) return;
+
+    skip_node* temp = (*l).head;
+    while (temp){
+        skip_node* next = (*temp).next[0];
+        free(temp); // deallocate memory
+        temp = next;
+    }
+    (*l).head = NULL;
+    (*l).level = 0;
+    (*l).length = 0;
+}
+
+
+/**
+ * @brief Splits a skip list in two skip lists at a specified node
+ * @details The first part (kept in l) includes all nodes up to and including the specified node,
+ * and the second part includes all nodes after it. Only the last pointer of each level is cut.
+ * Time complexity: O(log n + m) expected, n = number of nodes, m = number of nodes after the specified one (counted)
+ * @warning If memory allocation fails prints an error and exit program
+ * @param l Pointer to the skip list
+ * @param n Pointer to the node at which the list will be split
+ * @return skip_list The second part of the list.
+ * If the specified node is not found, the second part is empty
+ */
+skip_list skip_split_list_at_node(skip_list* l, skip_node* n){
+    skip_list second = {NULL, 0, 0, l ? (*l).seed ^ 0x9E3779B9u : 1};
+    skip_node* last[SKIP_MAX_LEVEL];
+    if (!skip_find_before(l, n, last) || !(*n).next[0]) return second;
+
+    for (int i = 0; i < (*n).level; i++) last[i] = n; // the last nodes of the first part
+    second.head = skip_create_node(0, SKIP_MAX_LEVEL);
+    for (int i = 0; i < SKIP_MAX_LEVEL; i++){
+        (*second.head).next[i] = (*last[i]).next[i];
+        (*last[i]).next[i] = NULL;
+        if ((*second.head).next[i]) second.level = i + 1;
+    }
+
+    for (skip_node* temp = (*second.head).next[0]; temp; temp = (*temp).next[0]) second.length++;
+    (*l).length -= second.length;
+    while ((*l).level > 0 && !(*(*l).head).next[(*l).level - 1]) (*l).level--;
+    return second;
+}
+
+/**
+ * @brief Splits a skip list in two skip lists at a specified value
+ * @details The first part (kept in l) includes all nodes up to and including the first node with the specified value,
+ * and the second part includes all nodes after it.
+ * Time complexity: O(log n + m) expected, n = number of nodes, m = number of nodes after the node with the value
+ * @warning If memory allocation fails prints an error and exit program
+ * @param l Pointer to the skip list
+ * @param value Value of the node at which the list will be split
+ * @return skip_list The second part of the list.
+ * If the specified value is not found, the second part is empty
+ */
+skip_list skip_split_list_at_value(skip_list* l, int value){
+    return skip_split_list_at_node(l, skip_value_in_list(l, value));
+}
+
+
+/**
+ * @brief Remove a node of a skip list
+ * @details Time complexity: O(log n + k) expected, n = number of nodes, k = number of nodes with the value of n before it
+ * @param l Pointer to the skip list
+ * @param n Pointer to the node to be removed from the list
+ * @return skip_node* Pointer to the removed node (to be freed by the caller).
+ * If the node is not found returns NULL
+ */
+skip_node* skip_remove_node(skip_list* l, skip_node* n){
+    skip_node* before[SKIP_MAX_LEVEL];
+    if (!skip_find_before(l, n, before)) return NULL;
+
+    for (int i = 0; i < (*n).level; i++){
+        (*before[i]).next[i] = (*n).next[i];
+        (*n).next[i] = NULL;
+    }
+    while ((*l).level > 0 && !(*(*l).head).next[(*l).level - 1]) (*l).level--;
+    (*l).length--;
+    return n;
+}
+
+/**
+ * @brief Remove the first node of the skip list with the value equals to the argument
+ * @details Time complexity: O(log n) expected, n = number of nodes in the list
+ * @param l Pointer to the skip list
+ * @param value The value of the node to be removed from the list
+ * @return skip_node* Pointer to the removed node (to be freed by the caller).
+ * If the value is not found returns NULL
+ */
+skip_node* skip_remove_node_with_value(skip_list* l, int value){
+    return skip_remove_node(l, skip_value_in_list(l, value));
+}
+
+
+/**
+ * @brief Checks if the skip list is empty
+ * @details Time complexity: O(1)
+ * @param l Pointer to the skip list
+ * @return int 1 if the list is empty, 0 otherwise
+ */
+int skip_is_empty_list(skip_list* l){
+    return !l || (*l).length == 0;
+}
+
+
+/**
+ * @brief First node of the values in a range
+ * @details The nodes of the range follow with next[0], while their value is not greater than high:
+ * for (skip_node* n = skip_range_first(l, low, high); n && (*n).value1 <= high; n = (*n).next[0])
+ * Time complexity: O(log n) expected, n = number of nodes in the list
+ * @param l Pointer to the skip list
+ * @param low The smallest value of the range
+ * @param high The greatest value of the range
+ * @return skip_node* Pointer to the first node with low <= value <= high, NULL if there isn't one
+ */
+skip_node* skip_range_first(skip_list* l, int low, int high){
+    skip_node* n = skip_lower_bound(l, low);
+    return n && (*n).value1 <= high ? n : NULL;
+}
+
+/**
+ * @brief Extracts the values in a range from a skip list into an array
+ * @details Time complexity: O(log n + k) expected, n = number of nodes in the list, k = number of values in the range
+ * @param l Pointer to the skip list
+ * @param low The smallest value of the range
+ * @param high The greatest value of the range
+ * @param count Where the number of values is written
+ * @return int* Pointer to an array of the values with low <= value <= high, sorted (to be freed by the caller).
+ * If the range is empty, returns NULL.
+ * If memory allocation fails, the program exits with an error
+ */
+int* skip_range_values(skip_list* l, int low, int high, unsigned int* count){
+    skip_node* first = skip_range_first(l, low, high);
+    unsigned int k = 0;
+    for (skip_node* temp = first; temp && (*temp).value1 <= high; temp = (*temp).next[0]) k++;
+    if (count) *count = k;
+    if (k == 0) return NULL;
+
+    int* values = (int*)malloc(k * sizeof(int)); // dynamic allocation for the values
+    if (!values) {
+        printf("Memory allocation failed\n");
+        exit(EXIT_FAILURE); // critical error
+    }
+    k = 0;
+    for (skip_node* temp = first; temp && (*temp).value1 <= high; temp = (*temp).next[0]) values[k++] = (*temp).value1;
+    return values;
+}
+
+
+/**
+ * @brief Calculates the length of the skip list
+ * @details Time complexity: O(1)
+ * @param l Pointer to the skip list
+ * @return unsigned int The number of nodes in the list
+ */
+unsigned int skip_list_length(skip_list* l){
+    return l ? (*l).length : 0;
+}
+
+
+/**
+ * @brief Finds the maximum value in the skip list
+ * @details The last node, reached from the highest level.
+ * Time complexity: O(log n) expected, n = number of nodes in the list
+ * @param l Pointer to the skip list
+ * @return int The maximum value.
+ * If the list is empty returns the default value of a node
+ */
+int skip_max_list(skip_list* l){
+    if (skip_is_empty_list(l)) return DEFAULT_VALUE;
+
+    skip_node* temp = (*l).head;
+    for (int i = (*l).level - 1; i >= 0; i--) while ((*temp).next[i]) temp = (*temp).next[i];
+    return (*temp).value1;
+}
+
+/**
+ * @brief Finds the minimum value in the skip list
+ * @details The first node.
+ * Time complexity: O(1)
+ * @param l Pointer to the skip list
+ * @return int The minimum value.
+ * If the list is empty returns the default value of a node
+ */
+int skip_min_list(skip_list* l){
+    if (skip_is_empty_list(l)) return DEFAULT_VALUE;
+    return (*(*(*l).head).next[0]).value1;
+}
+
+
+/**
+ * @brief Counts the nodes of the skip list with the value equals to the argument
+ * @details The nodes with the value are next to each other.
+ * Time complexity: O(log n + k) expected, n = number of nodes in the list, k = number of nodes with the value
+ * @param l Pointer to the skip list
+ * @param value The value to count
+ * @return int The number of nodes with the value
+ */
+int skip_count_frequents_in_list(skip_list* l, int value){
+    int count = 0;
+    for (skip_node* temp = skip_value_in_list(l, value); temp && (*temp).value1 == value; temp = (*temp).next[0]) count++;
+    return count;
+}
+
+
+
+// :::::::::::::::::::::::::::::::::::::::::::::::::: BENCHMARKS :::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+/**
+ * @brief Compares the skip list with the sorted list of nodes
+ * @details Random values. Prints ns/operation of searches and range queries (about 100 values)
+ * on the skip list (ops operations) and on the list sorted by sort_list (ops / 10000, they walk the list),
+ * and ns/operation of removing and inserting again random values in the skip list.
+ * Time complexity: O(n log n + ops * (log n + n / 10000))
+ * @param n Number of nodes of the lists
+ * @param ops Number of operations of each kind on the skip list
+ * @return void Doesn't return a value
+ */
+void benchmark_skip_list(unsigned int n, unsigned int ops){
+    if (n == 0) return;
+    int* values = benchmark_values(n);
+    srand(12345);
+    for (unsigned int i = 0; i < n; i++) values[i] = rand() % (n * 4 + 1);
+
+    clock_t start = clock();
+    skip_list skip = skip_create_list(values, n);
+    double create = ns_per_element(start, n);
+    node* sorted = sort_list(create_list(values, n));
+    int range = 400; // about 100 values in a range
+    long long sink = 0;
+
+    double search[2], ranges[2];
+    for (int k = 0; k < 2; k++){
+        unsigned int m = k ? ops / 10000 + 1 : ops;
+        start = clock();
+        for (unsigned int i = 0; i < m; i++){
+            int v = values[(i * 2654435761u) % n];
+            sink += k ? value_in_list(sorted, v).node2 != NULL : skip_value_in_list(&skip, v) != NULL;
+        }
+        search[k] = ns_per_element(start, m);
+
+        start = clock();
+        for (unsigned int i = 0; i < m; i++){
+            int low = values[(i * 2654435761u) % n];
+            if (k){
+                node* temp = sorted;
+                while (temp && (*temp).value1 < low) temp = (*temp).next;
+                for (; temp && (*temp).value1 <= low + range; temp = (*temp).next) sink++;
+            } else
+                for (skip_node* temp = skip_range_first(&skip, low, low + range); temp && (*temp).value1 <= low + range; temp = (*temp).next[0]) sink++;
+        }
+        ranges[k] = ns_per_element(start, m);
+    }
+
+    start = clock();
+    for (unsigned int i = 0; i < ops; i++){
+        int v = values[(i * 2654435761u) % n];
+        free(skip_remove_node_with_value(&skip, v));
+        skip_insertion(&skip, v);
+    }
+    double update = ns_per_element(start, ops);
+
+    printf("skip list (%u nodes, %d levels): create %.2f ns/node, remove + insert %.2f ns/op\n",
+           skip_list_length(&skip), skip.level, create, update);
+    printf("search: skip list %.2f ns/op, sorted list %.2f ns/op\n", search[0], search[1]);
+    printf("range of %d: skip list %.2f ns/op, sorted list %.2f ns/op (checksum %lld)\n", range, ranges[0], ranges[1], sink);
+    skip_clear_list(&skip);
+    clear_list(sorted);
+    free(values);
+}
+
+
+
+// :::::::::::::::::::::::::::::::::::::::::::::::::::::: TESTS ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+#define SKIP_TEST_VALUES 50 // values of the tests: 0, ..., SKIP_TEST_VALUES - 1
+
+/**
+ * @brief Checks a skip list against the expected values, used by the tests
+ * @details Level 0 must have the expected values in order and as many nodes as the length.
+ * Every level i must link exactly the nodes of level greater than i, in the order of level 0,
+ * the levels from the level of the list up must be empty and the highest level in use must not.
+ * Time complexity: O(n * SKIP_MAX_LEVEL), n = number of nodes in the list
+ * @param l Pointer to the skip list
+ * @param values Array of the expected values, sorted
+ * @param length Number of expected values
+ * @return int 1 if the list has the values and the links are right, 0 otherwise
+ */
+int test_skip_matches(skip_list* l, int values[], unsigned int length){
+    if ((*l).length != length) return 0;
+    if (!(*l).head) return length == 0 && (*l).level == 0;
+
+    unsigned int k = 0;
+    for (skip_node* temp = (*(*l).head).next[0]; temp; temp = (*temp).next[0], k++)
+        if (k >= length || (*temp).value1 != values[k] || (*temp).level < 1 || (*temp).level > SKIP_MAX_LEVEL) return 0;
+    if (k != length) return 0;
+
+    for (int i = 0; i < SKIP_MAX_LEVEL; i++){
+        skip_node* expected = (*(*l).head).next[i];
+        if ((i >= (*l).level) != !expected) return 0; // empty exactly from the level of the list up
+        for (skip_node* temp = (*(*l).head).next[0]; temp; temp = (*temp).next[0]){
+            if ((*temp).level <= i) continue;
+            if (temp != expected) return 0;
+            expected = (*temp).next[i];
+        }
+        if (expected) return 0;
+    }
+    return 1;
+}
+
+/**
+ * @brief Sorted values from the number of times each value is in a list, used by the tests
+ * @details Time complexity: O(SKIP_TEST_VALUES + n), n = number of values
+ * @param counts Array of SKIP_TEST_VALUES counts, counts[v] = number of nodes with the value v
+ * @param values Array where the sorted values are written (large enough)
+ * @return unsigned int Number of values
+ */
+unsigned int test_skip_expected(unsigned int counts[], int values[]){
+    unsigned int length = 0;
+    for (int v = 0; v < SKIP_TEST_VALUES; v++)
+        for (unsigned int c = 0; c < counts[v]; c++) values[length++] = v;
+    return length;
+}
+
+/**
+ * @brief Tests the insertions, searches and removes of a skip list
+ * @details Inserts 300 random values from 0 to SKIP_TEST_VALUES - 1 (with duplicates), then removes half of them,
+ * checking the order and the links of every level. Equal values must keep their insertion order,
+ * and the searches and removes of values and nodes not in the list must return NULL.
+ * At the end every node is removed and the list must be empty at every level.
+ * Time complexity: O(n * SKIP_MAX_LEVEL), n = 300
+ * @return int 1 if the test passes, 0 otherwise
+ */
+int test_skip_insert_remove(){
+    unsigned int counts[SKIP_TEST_VALUES] = {0};
+    int values[300], expected[300];
+    srand(2024);
+    for (int i = 0; i < 300; i++) values[i] = rand() % SKIP_TEST_VALUES;
+
+    skip_list l = skip_create_list(NULL, 0);
+    int passed = test_skip_matches(&l, NULL, 0) && !skip_value_in_list(&l, 3) && !skip_remove_node_with_value(&l, 3);
+    for (int i = 0; i < 300; i++){
+        skip_insertion(&l, values[i]);
+        counts[values[i]]++;
+    }
+    passed = passed && test_skip_matches(&l, expected, test_skip_expected(counts, expected));
+
+    skip_node* first = skip_insertion(&l, SKIP_TEST_VALUES); // three equal values, in this order
+    skip_node* second = skip_insertion(&l, SKIP_TEST_VALUES);
+    skip_node* third = skip_insertion(&l, SKIP_TEST_VALUES);
+    passed = passed && skip_value_in_list(&l, SKIP_TEST_VALUES) == first && (*first).next[0] == second;
+    passed = passed && (*second).next[0] == third && !(*third).next[0] && skip_count_frequents_in_list(&l, SKIP_TEST_VALUES) == 3;
+    passed = passed && skip_remove_node(&l, second) == second && !skip_remove_node(&l, second); // removed from the middle
+    passed = passed && skip_remove_node_with_value(&l, SKIP_TEST_VALUES) == first; // the first one
+    passed = passed && skip_remove_node(&l, third) == third && !skip_value_in_list(&l, SKIP_TEST_VALUES);
+    free(first);
+    free(second);
+    free(third);
+    passed = passed && test_skip_matches(&l, expected, test_skip_expected(counts, expected));
+
+    passed = passed && !skip_value_in_list(&l, -1) && !skip_remove_node_with_value(&l, -1) && !skip_remove_node(&l, NULL);
+    for (int i = 0; i < 150; i++){
+        skip_node* removed = skip_remove_node_with_value(&l, values[i]);
+        passed = passed && removed && (*removed).value1 == values[i];
+        free(removed);
+        counts[values[i]]--;
+    }
+    passed = passed && test_skip_matches(&l, expected, test_skip_expected(counts, expected));
+    passed = passed && skip_min_list(&l) == expected[0] && skip_max_list(&l) == expected[149];
+
+    for (int i = 150; i < 300; i++) free(skip_remove_node_with_value(&l, values[i]));
+    passed = passed && test_skip_matches(&l, NULL, 0) && skip_is_empty_list(&l);
+    printf("insertions and removes: %s\n", passed ? "passed" : "FAILED");
+    skip_clear_list(&l);
+    return passed;
+}
+
+/**
+ * @brief Tests the splits and the range queries of a skip list
+ * @details On 200 random values from 0 to SKIP_TEST_VALUES - 1 (with duplicates):
+ * compares skip_range_values with the expected values for every range of the values
+ * (empty ranges and ranges out of the values included), then splits copies of the list at the first node
+ * of each value, and the second part of a split at a value not in the list and at its last node,
+ * checking the values and the links of both parts.
+ * Time complexity: O(SKIP_TEST_VALUES^2 * n), n = 200
+ * @return int 1 if the test passes, 0 otherwise
+ */
+int test_skip_split_range(){
+    unsigned int counts[SKIP_TEST_VALUES] = {0};
+    int values[200], expected[200];
+    srand(7);
+    for (int i = 0; i < 200; i++){
+        values[i] = rand() % SKIP_TEST_VALUES;
+        counts[values[i]]++;
+    }
+    skip_list l = skip_create_list(values, 200);
+    unsigned int length = test_skip_expected(counts, expected);
+    int passed = test_skip_matches(&l, expected, length);
+
+    for (int low = -1; low <= SKIP_TEST_VALUES; low++)
+        for (int high = low - 1; high <= SKIP_TEST_VALUES; high++){
+            unsigned int count = 1234, k = 0;
+            int* range = skip_range_values(&l, low, high, &count);
+            for (unsigned int i = 0; i < length; i++)
+                if (expected[i] >= low && expected[i] <= high) passed = passed && k < count && range[k++] == expected[i];
+            passed = passed && k == count && (count > 0) == (range != NULL);
+            passed = passed && (skip_range_first(&l, low, high) != NULL) == (count > 0);
+            free(range);
+        }
+
+    unsigned int before = 0; // nodes with a smaller value
+    for (int value = 0; value < SKIP_TEST_VALUES; before += counts[value++]){ // split after the first node of each value
+        if (!counts[value]) continue;
+        skip_list copy = skip_create_list(values, 200);
+        skip_list second = skip_split_list_at_value(&copy, value);
+        passed = passed && test_skip_matches(&copy, expected, before + 1);
+        passed = passed && test_skip_matches(&second, expected + before + 1, length - before - 1);
+        skip_clear_list(&copy);
+        skip_clear_list(&second);
+    }
+    skip_list rest = skip_split_list_at_value(&l, expected[0]); // the head is kept
+    passed = passed && test_skip_matches(&l, expected, 1) && test_skip_matches(&rest, expected + 1, length - 1);
+
+    int missing = 0; // a value not in the list
+    while (missing < SKIP_TEST_VALUES && counts[missing]) missing++;
+    skip_list none = skip_split_list_at_value(&rest, missing < SKIP_TEST_VALUES ? missing : -1);
+    passed = passed && test_skip_matches(&none, NULL, 0) && test_skip_matches(&rest, expected + 1, length - 1);
+    skip_node* last = (*rest.head).next[0];
+    while ((*last).next[0]) last = (*last).next[0];
+    none = skip_split_list_at_node(&rest, last);
+    passed = passed && test_skip_matches(&none, NULL, 0) && test_skip_matches(&rest, expected + 1, length - 1);
+    printf("splits and ranges: %s\n", passed ? "passed" : "FAILED");
+    skip_clear_list(&l);
+    skip_clear_list(&rest);
+    return passed;
+}
+
+
+/**
+ * @brief Entry point of the program, used for testing
+ * @details Runs the tests, then the skip list benchmark
+ * (the optional arguments are the number of nodes, default 1000000, and of operations, default 1000000).
+ * @return 0 if the tests pass, 1 otherwise
+ */
+int main(int argc, char* argv[]){
+    int passed = test_skip_insert_remove();
+    passed = test_skip_split_range() && passed;
+
+    unsigned int n = argc > 1 ? (unsigned int)strtoul(argv[1], NULL, 10) : 1000000;
+    unsigned int ops = argc > 2 ? (unsigned int)strtoul(argv[2], NULL, 10) : 1000000;
+    benchmark_skip_list(n, ops);
+    return passed ? 0 : 1;
+
+    /* compiling: gcc skipList.c -o skipList -lpthread
+    executing: skipList [nodes [operations]] */
+}
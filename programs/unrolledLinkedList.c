@@ -0,0 +1,857 @@
+// ::::::::::::::::::::::::::::::::::::::::::::::::: LIBRARIES :::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+/**
+ * @file unrolledLinkedList.c
+ * @author Lorenzo Mercuri
+ * @brief Methods for unrolled list manipulation
+ * @details Each node stores up to UNROLLED_CAPACITY values in one cache line,
+ * so a traversal has one cache miss every UNROLLED_CAPACITY values instead of one for each value.
+ * (unrolled linked list: https://en.wikipedia.org/wiki/Unrolled_linked_list).
+ * linkedList.c is included for the comparison with the list of nodes
+ */
+#define LINKEDLIST_NO_MAIN
+#include "linkedList.c"
+#include <limits.h> // UINT_MAX
+
+
+
+// ::::::::::::::::::::::::::::::::::::::::::::::::: UNROLLED_LIST :::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+/* LIST OF FUNCTIONS:
+    creations:
+        1) unrolled_create_node
+        2) unrolled_create_list
+        3) unrolled_from_list
+    4) unrolled_print_list
+    5) unrolled_clear_list
+    insertions:
+        6) unrolled_insertion_head
+        7) unrolled_insertion_end
+        8) unrolled_insertion_at
+    9) unrolled_concatenate_lists
+    10) unrolled_split_list_at_index
+    11) unrolled_split_list_at_value
+    removes:
+        12) unrolled_remove_at
+        13) unrolled_remove_value
+    changes:
+        14) unrolled_change_value_at
+        15) unrolled_change_value_with_value
+    16) unrolled_is_empty_list
+    17) unrolled_value_in_list
+    18) unrolled_reverse_list
+    19) unrolled_list_length
+    20) unrolled_max_list
+    21) unrolled_min_list
+    22) unrolled_count_frequents_in_list
+    23) unrolled_sort_list
+    24) unrolled_list_values */
+
+
+#define UNROLLED_CAPACITY 13 // 8 (next) + 4 (count) + 13 * 4 (values) = 64 bytes, one cache line
+#define UNROLLED_ALIGNMENT 64 // nodes start at a cache line, so each one is in a single line
+#define UNROLLED_MIN (UNROLLED_CAPACITY / 2) // nodes with fewer values are merged or refilled
+
+/**
+ * @struct unrolled_node
+ * @brief Represent a node of an unrolled linked list
+ * @details It has a pointer to the next node, the number of values used and the values.
+ * Time complexity: O(1)
+ */
+typedef struct unrolled_node{
+    struct unrolled_node* next;
+    int count;
+    int values[UNROLLED_CAPACITY]; // change type if needed (apply changes to all references)
+} unrolled_node;
+
+/**
+ * @struct unrolled_list
+ * @brief Represent an unrolled linked list
+ * @details It has the first node, the last node and the number of values.
+ * Time complexity: O(1)
+ */
+typedef struct{
+    unrolled_node* head;
+    unrolled_node* tail;
+    unsigned int length;
+} unrolled_list;
+
+
+/**
+ * @brief Create a new empty unrolled node
+ * @details Allocated at a multiple of UNROLLED_ALIGNMENT (malloc only guarantees 16 bytes,
+ * so a node would usually be split between two cache lines).
+ * Time complexity: O(1)
+ * @warning If memory allocation fails prints an error and exit program
+ * @return unrolled_node* Pointer to the new node
+ */
+unrolled_node* unrolled_create_node(){
+    size_t size = (sizeof(unrolled_node) + UNROLLED_ALIGNMENT - 1) / UNROLLED_ALIGNMENT * UNROLLED_ALIGNMENT;
+    unrolled_node* new_node = (unrolled_node*)aligned_alloc(UNROLLED_ALIGNMENT, size);
+    if (!new_node) {
+        printf("Memory allocation failed\n");
+        exit(EXIT_FAILURE); // critical error
+    }
+
+    (*new_node).next = NULL;
+    (*new_node).count = 0;
+    return new_node;
+}
+
+
+/**
+ * @brief Create a new unrolled linked list
+ * @details Every node is filled, the last one excepted.
+ * Time complexity: O(n), n = number of values
+ * @warning If memory allocation fails prints an error and exit program
+ * @param values Array of values to initialize the list
+ * @param length Number of elements in the values array
+ * @return unrolled_list The new list.
+ * If the argument is NULL or the length is zero returns an empty list
+ */
+unrolled_list unrolled_create_list(int values[], unsigned int length){
+    unrolled_list l = {NULL, NULL, 0};
+    if (length == 0 || values == NULL) return l;
+
+    for (unsigned int i = 0; i < length; i++){
+        if (!l.tail || (*l.tail).count == UNROLLED_CAPACITY){
+            unrolled_node* n = unrolled_create_node();
+            if (l.tail) (*l.tail).next = n;
+            else l.head = n;
+            l.tail = n;
+        }
+        (*l.tail).values[(*l.tail).count++] = values[i];
+    }
+    l.length = length;
+    return l;
+}
+
+/**
+ * @brief Create a new unrolled linked list from a linked list of nodes
+ * @details Time complexity: O(n), n = number of nodes in the list
+ * @warning If memory allocation fails prints an error and exit program
+ * @param head Pointer to the head of the linked list
+ * @return unrolled_list The new list with the same values
+ */
+unrolled_list unrolled_from_list(node* head){
+    int length = list_length(head);
+    int* values = list_values(head);
+    unrolled_list l = unrolled_create_list(values, (unsigned int)length);
+    free(values);
+    return l;
+}
+
+
+/**
+ * @brief Prints the values of the unrolled linked list
+ * @details Time complexity: O(n), n = number of values
+ * @param l Pointer to the list
+ * @return void Doesn't return a value
+ */
+void unrolled_print_list(unrolled_list* l){
+    if (!l || !(*l).head) return;
+
+    printf("[");
+    unsigned int printed = 0;
+    for (unrolled_node* temp = (*l).head; temp; temp = (*temp).next)
+        for (int i = 0; i < (*temp).count; i++) printf(++printed < (*l).length ? "%d, " : "%d", (*temp).values[i]);
+    printf("]");
+}
+
+
+/**
+ * @brief Frees the memory allocated for an unrolled linked list
+ * @details The list becomes empty.
+ * Time complexity: O(n / UNROLLED_CAPACITY), n = number of values
+ * @param l Pointer to the list
+ * @return void Doesn't return a value
+ */
+void unrolled_clear_list(unrolled_list* l){
+    if (!l) return;
+
+    unrolled_node* temp;
+    while ((*l).head){
+        temp = (*l).head;
+        (*l).head = (*temp).next;
+        free(temp); // deallocate memory
+    }
+    (*l).tail = NULL;
+    (*l).length = 0;
+}
+
+
+/**
+ * @brief Splits a full node in two half full nodes
+ * @details The second half of the values moves to a new node linked after n.
+ * Time complexity: O(UNROLLED_CAPACITY)
+ * @param l Pointer to the list
+ * @param n Pointer to the node to split
+ * @return unrolled_node* Pointer to the new node
+ */
+unrolled_node* unrolled_split_node(unrolled_list* l, unrolled_node* n){
+    unrolled_node* second = unrolled_create_node();
+    int half = (*n).count / 2;
+
+    (*second).count = (*n).count - half;
+    memcpy((*second).values, (*n).values + half, (*second).count * sizeof(int));
+    (*n).count = half;
+
+    (*second).next = (*n).next;
+    (*n).next = second;
+    if ((*l).tail == n) (*l).tail = second;
+    return second;
+}
+
+
+/**
+ * @brief Rebalances a node after a removal
+ * @details An empty node is unlinked, a node under UNROLLED_MIN values is merged with the next node
+ * or takes values from it until they are balanced.
+ * Time complexity: O(UNROLLED_CAPACITY)
+ * @param l Pointer to the list
+ * @param prev Pointer to the node before n (NULL if n is the head)
+ * @param n Pointer to the node to rebalance
+ * @return void Doesn't return a value
+ */
+void unrolled_rebalance(unrolled_list* l, unrolled_node* prev, unrolled_node* n){
+    if ((*n).count == 0){
+        if (prev) (*prev).next = (*n).next;
+        else (*l).head = (*n).next;
+        if ((*l).tail == n) (*l).tail = prev;
+        free(n);
+        return;
+    }
+
+    unrolled_node* next = (*n).next;
+    if ((*n).count >= UNROLLED_MIN || !next) return;
+
+    if ((*n).count + (*next).count <= UNROLLED_CAPACITY){ // merge
+        memcpy((*n).values + (*n).count, (*next).values, (*next).count * sizeof(int));
+        (*n).count += (*next).count;
+        (*n).next = (*next).next;
+        if ((*l).tail == next) (*l).tail = n;
+        free(next);
+    } else { // borrow from the next node
+        int moved = ((*next).count - (*n).count) / 2;
+        memcpy((*n).values + (*n).count, (*next).values, moved * sizeof(int));
+        memmove((*next).values, (*next).values + moved, ((*next).count - moved) * sizeof(int));
+        (*n).count += moved;
+        (*next).count -= moved;
+    }
+}
+
+
+/**
+ * @brief Finds the node containing a position
+ * @details Time complexity: O(n / UNROLLED_CAPACITY), n = index
+ * @param l Pointer to the list
+ * @param index Position of the value (0 = first value)
+ * @param prev Pointer where the node before the found one is stored (can be NULL)
+ * @param offset Pointer where the position inside the found node is stored
+ * @return unrolled_node* Pointer to the node containing the position.
+ * If the index is out of the list returns NULL
+ */
+unrolled_node* unrolled_find_index(unrolled_list* l, unsigned int index, unrolled_node** prev, int* offset){
+    if (prev) *prev = NULL;
+    if (index >= (*l).length) return NULL;
+
+    unrolled_node* temp = (*l).head;
+    while (index >= (unsigned int)(*temp).count){
+        index -= (*temp).count;
+        if (prev) *prev = temp;
+        temp = (*temp).next;
+    }
+    *offset = (int)index;
+    return temp;
+}
+
+
+/**
+ * @brief Inserts a value at a position of an unrolled linked list
+ * @details The values from the position on move one place forward,
+ * a full node is split in two half full nodes before the insertion.
+ * Time complexity: O(n / UNROLLED_CAPACITY + UNROLLED_CAPACITY), n = index
+ * @warning If memory allocation fails prints an error and exit program
+ * @param l Pointer to the list
+ * @param index Position of the new value (from 0 to the length of the list)
+ * @param value The value to insert
+ * @return int 1 if the value is inserted, 0 if the index is out of the list
+ */
+int unrolled_insertion_at(unrolled_list* l, unsigned int index, int value){
+    if (!l || index > (*l).length) return 0;
+
+    unrolled_node* n;
+    int offset;
+    if (index == (*l).length){ // append to the tail
+        n = (*l).tail;
+        if (!n){
+            n = unrolled_create_node();
+            (*l).head = (*l).tail = n;
+        }
+        offset = (*n).count;
+    } else n = unrolled_find_index(l, index, NULL, &offset);
+
+    if ((*n).count == UNROLLED_CAPACITY){ // overflow
+        unrolled_node* second = unrolled_split_node(l, n);
+        if (offset > (*n).count){
+            offset -= (*n).count;
+            n = second;
+        }
+    }
+
+    memmove((*n).values + offset + 1, (*n).values + offset, ((*n).count - offset) * sizeof(int));
+    (*n).values[offset] = value;
+    (*n).count++;
+    (*l).length++;
+    return 1;
+}
+
+/**
+ * @brief Inserts a value at the head of an unrolled linked list
+ * @details Time complexity: O(UNROLLED_CAPACITY)
+ * @param l Pointer to the list
+ * @param value The value to insert
+ * @return void Doesn't return a value
+ */
+void unrolled_insertion_head(unrolled_list* l, int value){
+    unrolled_insertion_at(l, 0, value);
+}
+
+/**
+ * @brief Inserts a value at the end of an unrolled linked list
+ * @details Time complexity: O(1) (amortized)
+ * @param l Pointer to the list
+ * @param value The value to insert
+ * @return void Doesn't return a value
+ */
+void unrolled_insertion_end(unrolled_list* l, int value){
+    if (!l) return;
+
+    if (!(*l).tail || (*(*l).tail).count == UNROLLED_CAPACITY){ // new node instead of splitting the tail
+        unrolled_node* n = unrolled_create_node();
+        if ((*l).tail) (*(*l).tail).next = n;
+        else (*l).head = n;
+        (*l).tail = n;
+    }
+    (*(*l).tail).values[(*(*l).tail).count++] = value;
+    (*l).length++;
+}
+
+
+/**
+ * @brief Concatenates two unrolled linked lists
+ * @details Links the second list after the first one, the second list becomes empty.
+ * If the two nodes at the junction fit in one node they are merged.
+ * Time complexity: O(UNROLLED_CAPACITY)
+ * @param l1 Pointer to the first list
+ * @param l2 Pointer to the second list
+ * @return void Doesn't return a value
+ */
+void unrolled_concatenate_lists(unrolled_list* l1, unrolled_list* l2){
+    if (!l1 || !l2 || l1 == l2 || !(*l2).head) return;
+
+    if (!(*l1).head){
+        (*l1).head = (*l2).head;
+        (*l1).tail = (*l2).tail;
+    } else {
+        unrolled_node* junction = (*l1).tail;
+        (*junction).next = (*l2).head;
+        (*l1).tail = (*l2).tail;
+        unrolled_rebalance(l1, NULL, junction); // prev is not needed, the junction is never empty
+    }
+    (*l1).length += (*l2).length;
+
+    (*l2).head = (*l2).tail = NULL;
+    (*l2).length = 0;
+}
+
+
+/**
+ * @brief Splits an unrolled linked list in two lists at a position
+ * @details The first part (kept in l) includes all values up to and including the position,
+ * and the second part includes all values after it.
+ * Time complexity: O(n / UNROLLED_CAPACITY + UNROLLED_CAPACITY), n = index
+ * @warning If memory allocation fails prints an error and exit program
+ * @param l Pointer to the list
+ * @param index Position of the last value of the first part
+ * @return unrolled_list The second part of the list.
+ * If the index is out of the list, the second part is empty
+ */
+unrolled_list unrolled_split_list_at_index(unrolled_list* l, unsigned int index){
+    unrolled_list second = {NULL, NULL, 0};
+    if (!l || (*l).length == 0 || index >= (*l).length - 1) return second;
+
+    int offset;
+    unrolled_node* n = unrolled_find_index(l, index, NULL, &offset);
+    if (offset + 1 < (*n).count){ // the split point is inside the node
+        unrolled_node* rest = unrolled_create_node();
+        (*rest).count = (*n).count - offset - 1;
+        memcpy((*rest).values, (*n).values + offset + 1, (*rest).count * sizeof(int));
+        (*n).count = offset + 1;
+        (*rest).next = (*n).next;
+        (*n).next = rest;
+        if ((*l).tail == n) (*l).tail = rest;
+    }
+
+    second.head = (*n).next;
+    second.tail = (*l).tail;
+    second.length = (*l).length - index - 1;
+    (*n).next = NULL;
+    (*l).tail = n;
+    (*l).length = index + 1;
+    return second;
+}
+
+
+/**
+ * @brief Searches for a value in an unrolled linked list
+ * @details Time complexity: O(n), n = number of values seen in the list
+ * @param l Pointer to the list
+ * @param value Value to be searched for in the list
+ * @return long Position of the first value equal to the argument.
+ * If the value is not found returns -1
+ */
+long unrolled_value_in_list(unrolled_list* l, int value){
+    if (!l) return -1;
+
+    long index = 0;
+    for (unrolled_node* temp = (*l).head; temp; temp = (*temp).next){
+        for (int i = 0; i < (*temp).count; i++) if ((*temp).values[i] == value) return index + i;
+        index += (*temp).count;
+    }
+    return -1;
+}
+
+
+/**
+ * @brief Splits an unrolled linked list in two lists at a value
+ * @details The first part (kept in l) includes all values up to and including the first value equal to the argument,
+ * and the second part includes all values after it.
+ * Time complexity: O(n), n = number of values before the specified value
+ * @param l Pointer to the list
+ * @param value Value at which the list will be split
+ * @return unrolled_list The second part of the list.
+ * If the value is not found, the second part is empty
+ */
+unrolled_list unrolled_split_list_at_value(unrolled_list* l, int value){
+    unrolled_list second = {NULL, NULL, 0};
+    long index = unrolled_value_in_list(l, value);
+    if (index < 0) return second;
+    return unrolled_split_list_at_index(l, (unsigned int)index);
+}
+
+
+/**
+ * @brief Removes the value at a position of an unrolled linked list
+ * @details The node is rebalanced if it goes under UNROLLED_MIN values.
+ * Time complexity: O(n / UNROLLED_CAPACITY + UNROLLED_CAPACITY), n = index
+ * @param l Pointer to the list
+ * @param index Position of the value to remove
+ * @param removed Pointer where the removed value is stored (can be NULL)
+ * @return int 1 if the value is removed, 0 if the index is out of the list
+ */
+int unrolled_remove_at(unrolled_list* l, unsigned int index, int* removed){
+    if (!l) return 0;
+
+    unrolled_node* prev;
+    int offset;
+    unrolled_node* n = unrolled_find_index(l, index, &prev, &offset);
+    if (!n) return 0;
+
+    if (removed) *removed = (*n).values[offset];
+    memmove((*n).values + offset, (*n).values + offset + 1, ((*n).count - offset - 1) * sizeof(int));
+    (*n).count--;
+    (*l).length--;
+    unrolled_rebalance(l, prev, n);
+    return 1;
+}
+
+/**
+ * @brief Removes the first value of an unrolled linked list equal to the argument
+ * @details Time complexity: O(n), n = number of values seen in the list
+ * @param l Pointer to the list
+ * @param value The value to remove
+ * @return int 1 if the value is removed, 0 if it is not found
+ */
+int unrolled_remove_value(unrolled_list* l, int value){
+    long index = unrolled_value_in_list(l, value);
+    if (index < 0) return 0;
+    return unrolled_remove_at(l, (unsigned int)index, NULL);
+}
+
+
+/**
+ * @brief Changes the value at a position of an unrolled linked list
+ * @details Time complexity: O(n / UNROLLED_CAPACITY), n = index
+ * @param l Pointer to the list
+ * @param index Position of the value to change
+ * @param new_value The new value
+ * @return int 1 if the value is changed, 0 if the index is out of the list
+ */
+int unrolled_change_value_at(unrolled_list* l, unsigned int index, int new_value){
+    if (!l) return 0;
+
+    int offset;
+    unrolled_node* n = unrolled_find_index(l, index, NULL, &offset);
+    if (!n) return 0;
+    (*n).values[offset] = new_value;
+    return 1;
+}
+
+/**
+ * @brief Changes the first value of an unrolled linked list equal to the argument
+ * @details Time complexity: O(n), n = number of values seen in the list
+ * @param l Pointer to the list
+ * @param value The value to change
+ * @param new_value The new value
+ * @return int 1 if the value is changed, 0 if it is not found
+ */
+int unrolled_change_value_with_value(unrolled_list* l, int value, int new_value){
+    if (!l) return 0;
+
+    for (unrolled_node* temp = (*l).head; temp; temp = (*temp).next)
+        for (int i = 0; i < (*temp).count; i++)
+            if ((*temp).values[i] == value){
+                (*temp).values[i] = new_value;
+                return 1;
+            }
+    return 0;
+}
+
+
+/**
+ * @brief Checks if an unrolled linked list is empty
+ * @details Time complexity: O(1)
+ * @param l Pointer to the list
+ * @return int Returns 1 if the list is empty, otherwise returns 0
+ */
+int unrolled_is_empty_list(unrolled_list* l){
+    return !l || (*l).length == 0;
+}
+
+
+/**
+ * @brief Reverses an unrolled linked list
+ * @details Reverses the order of the nodes and the values inside each node.
+ * Time complexity: O(n), n = number of values
+ * @param l Pointer to the list
+ * @return void Doesn't return a value
+ */
+void unrolled_reverse_list(unrolled_list* l){
+    if (!l) return;
+
+    unrolled_node* prev = NULL;
+    unrolled_node* current = (*l).head;
+    (*l).tail = current;
+    while (current){
+        for (int i = 0, j = (*current).count - 1; i < j; i++, j--){
+            int temp = (*current).values[i];
+            (*current).values[i] = (*current).values[j];
+            (*current).values[j] = temp;
+        }
+        unrolled_node* next = (*current).next;
+        (*current).next = prev;
+        prev = current;
+        current = next;
+    }
+    (*l).head = prev;
+}
+
+
+/**
+ * @brief Length of an unrolled linked list
+ * @details Time complexity: O(1)
+ * @param l Pointer to the list
+ * @return unsigned int The number of values
+ */
+unsigned int unrolled_list_length(unrolled_list* l){
+    return l ? (*l).length : 0;
+}
+
+
+/**
+ * @brief Max value of an unrolled linked list
+ * @details Time complexity: O(n), n = number of values
+ * @param l Pointer to the list
+ * @return int The max value of the list.
+ * If the list is empty return the default value of a node
+ */
+int unrolled_max_list(unrolled_list* l){
+    if (!l || !(*l).head) return DEFAULT_VALUE;
+
+    int max = (*(*l).head).values[0];
+    for (unrolled_node* temp = (*l).head; temp; temp = (*temp).next)
+        for (int i = 0; i < (*temp).count; i++) if ((*temp).values[i] > max) max = (*temp).values[i];
+    return max;
+}
+
+/**
+ * @brief Min value of an unrolled linked list
+ * @details Time complexity: O(n), n = number of values
+ * @param l Pointer to the list
+ * @return int The min value of the list.
+ * If the list is empty return the default value of a node
+ */
+int unrolled_min_list(unrolled_list* l){
+    if (!l || !(*l).head) return DEFAULT_VALUE;
+
+    int min = (*(*l).head).values[0];
+    for (unrolled_node* temp = (*l).head; temp; temp = (*temp).next)
+        for (int i = 0; i < (*temp).count; i++) if ((*temp).values[i] < min) min = (*temp).values[i];
+    return min;
+}
+
+
+/**
+ * @brief Counts the frequency of a value in an unrolled linked list
+ * @details Time complexity: O(n), n = number of values
+ * @param l Pointer to the list
+ * @param value The value to count the frequency of
+ * @return int The frequency of the value
+ */
+int unrolled_count_frequents_in_list(unrolled_list* l, int value){
+    if (!l) return 0;
+
+    int freq = 0;
+    for (unrolled_node* temp = (*l).head; temp; temp = (*temp).next)
+        for (int i = 0; i < (*temp).count; i++) freq += (*temp).values[i] == value;
+    return freq;
+}
+
+
+/**
+ * @brief Extracts the values from an unrolled linked list into an array
+ * @details Copies a node at a time.
+ * Time complexity: O(n), n = number of values
+ * @param l Pointer to the list
+ * @return int* Pointer to an array containing the values.
+ * If the list is empty, returns NULL.
+ * If memory allocation fails, the program exits with an error
+ */
+int* unrolled_list_values(unrolled_list* l){
+    if (!l || !(*l).head) return NULL;
+
+    int* values = (int*)malloc((*l).length * sizeof(int)); // dynamic allocation for the values
+    if (!values) {
+        printf("Memory allocation failed\n");
+        exit(EXIT_FAILURE); // critical error
+    }
+
+    unsigned int index = 0;
+    for (unrolled_node* temp = (*l).head; temp; temp = (*temp).next){
+        memcpy(values + index, (*temp).values, (*temp).count * sizeof(int));
+        index += (*temp).count;
+    }
+    return values;
+}
+
+
+/**
+ * @brief Compares two integers for qsort
+ * @details Time complexity: O(1)
+ * @param a Pointer to the first integer
+ * @param b Pointer to the second integer
+ * @return int Negative, zero or positive if a is less, equal or greater than b
+ */
+int unrolled_compare(const void* a, const void* b){
+    int x = *(const int*)a, y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Sorts an unrolled linked list
+ * @details Copies the values in an array, sorts it with qsort and writes them back in the same nodes.
+ * Time complexity: O(n log n), n = number of values
+ * @warning If memory allocation fails prints an error and exit program
+ * @param l Pointer to the list
+ * @return void Doesn't return a value
+ */
+void unrolled_sort_list(unrolled_list* l){
+    int* values = unrolled_list_values(l);
+    if (!values) return;
+
+    qsort(values, (*l).length, sizeof(int), unrolled_compare);
+    unsigned int index = 0;
+    for (unrolled_node* temp = (*l).head; temp; temp = (*temp).next){
+        memcpy((*temp).values, values + index, (*temp).count * sizeof(int));
+        index += (*temp).count;
+    }
+    free(values);
+}
+
+
+
+// :::::::::::::::::::::::::::::::::::::::::::::::::: BENCHMARKS :::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+/**
+ * @brief Creates a linked list whose nodes are allocated in random order
+ * @details The nodes are allocated for values 0..n-1 and linked in a random permutation of the allocation order,
+ * like a list after many insertions and removals.
+ * Time complexity: O(n)
+ * @warning If memory allocation fails prints an error and exit program
+ * @param values Array of values of the list
+ * @param n Number of values
+ * @return node* Pointer to the head of the list
+ */
+node* shuffled_list(int values[], unsigned int n){
+    if (n == 0) return NULL;
+
+    node** nodes = (node**)malloc(n * sizeof(node*));
+    if (!nodes) {
+        printf("Memory allocation failed\n");
+        exit(EXIT_FAILURE); // critical error
+    }
+    for (unsigned int i = 0; i < n; i++) nodes[i] = create_node(0);
+
+    srand(12345);
+    for (unsigned int i = n - 1; i > 0; i--){ // Fisher-Yates shuffle
+        unsigned int j = (unsigned int)(((unsigned long long)rand() * RAND_MAX + rand()) % (i + 1));
+        node* temp = nodes[i];
+        nodes[i] = nodes[j];
+        nodes[j] = temp;
+    }
+    for (unsigned int i = 0; i < n; i++){
+        (*nodes[i]).value1 = values[i];
+        (*nodes[i]).next = i + 1 < n ? nodes[i + 1] : NULL;
+    }
+
+    node* head = nodes[0];
+    free(nodes);
+    return head;
+}
+
+
+/**
+ * @brief Compares the traversal of the unrolled list with the list of nodes
+ * @details Prints ns/value of max, min, count_frequents and value_in (absent value, whole list)
+ * on a list of nodes allocated in order, a list of nodes allocated in random order and an unrolled list.
+ * Time complexity: O(n * rounds)
+ * @param n Number of values
+ * @param rounds Number of repetitions of each traversal
+ * @return void Doesn't return a value
+ */
+void benchmark_traversal(unsigned int n, int rounds){
+    int* values = benchmark_values(n);
+    node* sequential = create_list(values, n);
+    node* shuffled = shuffled_list(values, n);
+    unrolled_list unrolled = unrolled_create_list(values, n);
+    long long sink = 0;
+    unsigned int total = n * (unsigned int)rounds;
+
+    const char* names[] = {"sequential nodes", "shuffled nodes"};
+    node* lists[] = {sequential, shuffled};
+    for (int k = 0; k < 2; k++){
+        clock_t start = clock();
+        for (int r = 0; r < rounds; r++) sink += max_list(lists[k]);
+        double max = ns_per_element(start, total);
+        start = clock();
+        for (int r = 0; r < rounds; r++) sink += min_list(lists[k]);
+        double min = ns_per_element(start, total);
+        start = clock();
+        for (int r = 0; r < rounds; r++) sink += count_frequents_in_list(lists[k], r);
+        double count = ns_per_element(start, total);
+        start = clock();
+        for (int r = 0; r < rounds; r++) sink += value_in_list(lists[k], -1).node2 != NULL;
+        double search = ns_per_element(start, total);
+        printf("%s: max %.2f, min %.2f, count %.2f, search %.2f ns/value\n", names[k], max, min, count, search);
+    }
+
+    clock_t start = clock();
+    for (int r = 0; r < rounds; r++) sink += unrolled_max_list(&unrolled);
+    double max = ns_per_element(start, total);
+    start = clock();
+    for (int r = 0; r < rounds; r++) sink += unrolled_min_list(&unrolled);
+    double min = ns_per_element(start, total);
+    start = clock();
+    for (int r = 0; r < rounds; r++) sink += unrolled_count_frequents_in_list(&unrolled, r);
+    double count = ns_per_element(start, total);
+    start = clock();
+    for (int r = 0; r < rounds; r++) sink += unrolled_value_in_list(&unrolled, -1);
+    double search = ns_per_element(start, total);
+    printf("unrolled (%d values/node): max %.2f, min %.2f, count %.2f, search %.2f ns/value\n",
+           UNROLLED_CAPACITY, max, min, count, search);
+    printf("(checksum %lld)\n", sink);
+
+    clear_list(sequential);
+    clear_list(shuffled);
+    unrolled_clear_list(&unrolled);
+    free(values);
+}
+
+
+
+// :::::::::::::::::::::::::::::::::::::::::::::::::::::: TESTS ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+/**
+ * @brief Tests the concatenation into an empty unrolled list
+ * @details Concatenates a list of 20 values (two nodes) into an empty list, then appends a value:
+ * the list must have the 21 values in order, the tail must be the last node and the second list must be empty.
+ * Time complexity: O(1)
+ * @return int 1 if the test passes, 0 otherwise
+ */
+int test_concatenate_into_empty(){
+    int values[21];
+    for (int i = 0; i < 21; i++) values[i] = i;
+    unrolled_list l1 = {NULL, NULL, 0};
+    unrolled_list l2 = unrolled_create_list(values, 20);
+
+    unrolled_concatenate_lists(&l1, &l2);
+    int passed = l1.tail && !(*l1.tail).next && !l2.head && !l2.tail && l2.length == 0;
+    unrolled_insertion_end(&l1, 20);
+
+    unsigned int i = 0;
+    for (unrolled_node* temp = l1.head; temp; temp = (*temp).next)
+        for (int k = 0; k < (*temp).count; k++, i++) passed = passed && i < 21 && (*temp).values[k] == values[i];
+    passed = passed && i == 21 && unrolled_list_length(&l1) == 21 && (*l1.tail).values[(*l1.tail).count - 1] == 20;
+    printf("concatenation into an empty list: %s\n", passed ? "passed" : "FAILED");
+    unrolled_clear_list(&l1);
+    return passed;
+}
+
+/**
+ * @brief Tests the split of an unrolled list at indexes out of the list
+ * @details Splits a list of 20 values at UINT_MAX, at the last index and at the index 4:
+ * the first two splits must return an empty list and leave the 20 values, the last one must leave 5 values
+ * and return the other 15. An empty list split at 0 must return an empty list.
+ * Time complexity: O(1)
+ * @return int 1 if the test passes, 0 otherwise
+ */
+int test_split_out_of_list(){
+    int values[20];
+    for (int i = 0; i < 20; i++) values[i] = i;
+    unrolled_list l = unrolled_create_list(values, 20);
+    unrolled_list empty = {NULL, NULL, 0};
+
+    unrolled_list second = unrolled_split_list_at_index(&l, UINT_MAX);
+    int passed = !second.head && second.length == 0 && l.length == 20;
+    second = unrolled_split_list_at_index(&l, 19);
+    passed = passed && !second.head && second.length == 0 && l.length == 20;
+    second = unrolled_split_list_at_index(&empty, 0);
+    passed = passed && !second.head && second.length == 0;
+    second = unrolled_split_list_at_index(&l, 4);
+    int expected = 0; // the values of both parts in order
+    for (unrolled_node* temp = l.head; temp; temp = (*temp).next)
+        for (int k = 0; k < (*temp).count; k++) passed = passed && (*temp).values[k] == expected++;
+    passed = passed && expected == 5 && l.length == 5 && (*l.tail).values[(*l.tail).count - 1] == 4;
+    for (unrolled_node* temp = second.head; temp; temp = (*temp).next)
+        for (int k = 0; k < (*temp).count; k++) passed = passed && (*temp).values[k] == expected++;
+    passed = passed && expected == 20 && second.length == 15 && (*second.tail).values[(*second.tail).count - 1] == 19;
+    printf("split out of the list: %s\n", passed ? "passed" : "FAILED");
+    unrolled_clear_list(&l);
+    unrolled_clear_list(&second);
+    return passed;
+}
+
+
+/**
+ * @brief Entry point of the program, used for testing
+ * @details Runs the tests, then the traversal benchmark
+ * (the optional argument is the number of values, default 1000000).
+ * @return 0 if the tests pass, 1 otherwise
+ */
+int main(int argc, char* argv[]){
+    unsigned int n = argc > 1 ? (unsigned int)strtoul(argv[1], NULL, 10) : 1000000;
+    int passed = test_concatenate_into_empty();
+    passed = test_split_out_of_list() && passed;
+    benchmark_traversal(n, 10);
+    return passed ? 0 : 1;
+
+    /* compiling: gcc unrolledLinkedList.c -o unrolledLinkedList -lpthread
+    executing: unrolledLinkedList [values] */
+}